@@ -1,6 +1,9 @@
 #include "Prerequisites.h"
 #include "BaseApp.h"
 
+// Reemplaza new/delete globales para contar las reservas de heap por frame
+EU_DEFINE_ALLOCATION_HOOKS()
+
 // Global Variables
 BaseApp app;
 
@@ -14,6 +14,8 @@
 #include "UserInterface.h"
 #include "ModelLoader.h"
 #include "ECS\Actor.h"
+#include "ECS\SystemScheduler.h"
+#include "ECS\CommandBuffer.h"
 
 /**
  * @brief Clase principal de la aplicación que gestiona el bucle principal del motor y el pipeline de renderizado DirectX.
@@ -41,6 +43,18 @@ public:
     void
     destroy();
 
+    /**
+     * @brief Comprueba que un frame estable no haya pedido memoria al heap.
+     *
+     * Los primeros frames tras arrancar o importar un modelo son de calentamiento y no se
+     * comprueban. Pasado ese margen, un frame con reservas se registra como error y, en Debug,
+     * dispara un assert.
+     * @param frameAllocations Reservas del hilo principal durante update() y render()
+     * @return false si el frame estable reservó memoria
+     */
+    bool
+    checkFrameAllocations(const EU::AllocationCounts& frameAllocations);
+
     /**
      * @brief Ejecuta el bucle principal de la aplicación con manejo de ventanas Win32.
      * @param hInstance Instancia actual de la aplicación
@@ -93,6 +107,7 @@ private:
     Texture m_shadowSRVTexture; ///< Vista de recurso de shader para la textura de sombras
     DepthStencilView m_shadowDSV; ///< Vista de profundidad y stencil para el mapa de sombras
     Viewport m_shadowViewport; ///< Viewport para el pase de sombras
+    Rasterizer m_shadowRasterizer; ///< Estado de raster del pase de sombras (el mismo que el de los actores)
     Buffer m_lightBuffer; ///< Buffer constante para matrices y posición de luz
     CBLight cbLight; ///< Datos del lado CPU para el buffer de luz
 
@@ -103,9 +118,19 @@ private:
     CBNeverChanges cbNeverChanges; ///< Estructura de datos constantes que nunca cambian
     CBChangeOnResize cbChangesOnResize; ///< Estructura de datos que cambian al redimensionar
     UserInterface m_userInterface; ///< Sistema de interfaz de usuario
+    EU::TFrameArena<2> m_frameArena; ///< Memoria temporal por frame (doble búfer), se reinicia al inicio de update()
+    unsigned int m_steadyFrames = 0; ///< Frames seguidos sin importar nada; pasado el calentamiento no deben reservar heap
+    bool m_reportedFrameAllocations = false; ///< Ya se avisó de un frame estable con reservas
+
+    EU::TThreadPool m_threadPool; ///< Trabajadores para los bucles paralelos del frame
+    SystemScheduler m_systems{ m_threadPool }; ///< Sistemas del ECS que se ejecutan cada frame
+
+    World m_world; ///< Componentes de todos los actores; debe declararse antes que los actores que lo usan
+    Query<const MeshRenderer> m_shadowCasters; ///< Datos de dibujo de las entidades que proyectan sombra
+    EntityCommandQueue m_commands; ///< Cambios estructurales diferidos hasta el inicio del siguiente update
 
     // Se eliminó el puntero específico al Actor de la pistola.
-    EU::TSharedPointer<Actor> m_APlane;
+    EU::TRefPtr<Actor> m_APlane;
     // Este vector contendrá todos los actores, incluyendo los importados.
-    std::vector<EU::TSharedPointer<Actor>> m_actors;
+    std::vector<EU::TRefPtr<Actor>> m_actors;
 };
@@ -70,9 +70,28 @@ public:
                  D3D11_BUFFER_DESC& desc,
                  D3D11_SUBRESOURCE_DATA* initData);
 
+    /**
+     * @brief Etiqueta de memoria del buffer: MESH para vértices e índices, RENDER para el resto.
+     */
+    EU::EMemoryTag
+    memoryTag() const;
+
+    /**
+     * @brief Buffer nativo, para quien necesite guardar el handle (p. ej. MeshRenderer).
+     */
+    ID3D11Buffer*
+    getBuffer() const { return m_buffer; }
+
+    /**
+     * @brief Bytes por elemento (vértice) del buffer.
+     */
+    unsigned int
+    getStride() const { return m_stride; }
+
 private:
     ID3D11Buffer* m_buffer = nullptr; ///< Buffer nativo de DirectX 11
     unsigned int m_stride = 0; ///< Tamaño en bytes de cada elemento
     unsigned int m_offset = 0; ///< Desplazamiento en bytes desde el inicio
     unsigned int m_bindFlag = 0; ///< Flags de vinculación del buffer
+    unsigned int m_trackedBytes = 0; ///< Bytes de GPU registrados en el tracker de memoria
 };
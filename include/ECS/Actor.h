@@ -4,6 +4,8 @@
 #include "Buffer.h"
 #include "Texture.h"
 #include "Transform.h"
+#include "ShadowCaster.h"
+#include "MeshRenderer.h"
 #include "SamplerState.h"
 #include "Rasterizer.h"
 #include "BlendState.h"
@@ -21,7 +23,7 @@ class MeshComponent;
  * flexible de comportamientos a través de componentes especializados para diferentes aspectos del renderizado 3D.
  */
 class
-Actor : public Entity {
+Actor : public Entity, public EU::TPooled<Actor, EU::EMemoryTag::ECS> {
 public:
     /**
      * @brief Constructor por defecto.
@@ -33,7 +35,7 @@ public:
      * @param v true para recibir sombras, false para no recibirlas
      */
     void
-    setReceiveShadow(bool v) { m_receiveShadow = v; }
+    setReceiveShadow(bool v) { m_receiveShadow = v; m_modelDirty = true; }
 
     /**
      * @brief Obtiene el estado actual de recepción de sombras.
@@ -43,29 +45,46 @@ public:
     getReceiveShadow() const { return m_receiveShadow; }
 
     /**
-     * @brief Constructor que inicializa el actor con un dispositivo DirectX.
+     * @brief Constructor que crea el actor en el mundo y lo inicializa con un dispositivo DirectX.
+     * @param world Mundo donde se guardan los componentes del actor
      * @param device Dispositivo DirectX para inicializar recursos de renderizado
      */
-    Actor(Device& device);
+    Actor(World& world, Device& device);
 
     /**
      * @brief Destructor virtual.
      */
     virtual
-    ~Actor() = default;
+    ~Actor();
 
     void
     init() override {
     }
 
     /**
-     * @brief Actualiza el actor.
+     * @brief Actualiza el actor: updateCPU() seguido de uploadGPU().
      * @param deltaTime El tiempo transcurrido desde la última actualización.
      * @param deviceContext Contexto del dispositivo para operaciones gráficas.
      */
     void
     update(float deltaTime, DeviceContext& deviceContext) override;
 
+    /**
+     * @brief Parte de la actualización que no toca el dispositivo: prepara los datos de los
+     * constant buffers a partir del Transform. Puede llamarse en paralelo para actores distintos.
+     * @param deltaTime El tiempo transcurrido desde la última actualización.
+     */
+    void
+    updateCPU(float deltaTime);
+
+    /**
+     * @brief Sube los constant buffers preparados por updateCPU() que hayan cambiado.
+     * Solo desde el hilo que usa el contexto inmediato.
+     * @param deviceContext Contexto del dispositivo para subir los buffers.
+     */
+    void
+    uploadGPU(DeviceContext& deviceContext);
+
     /**
      * @brief Renderiza el actor.
      * @param deviceContext Contexto del dispositivo para operaciones gráficas.
@@ -80,50 +99,96 @@ public:
     destroy();
 
     /**
-     * @brief Establece las mallas del actor.
+     * @brief Establece las mallas del actor tomando posesión de ellas, sin copiar vértices.
      * @param device El dispositivo con el cual se inicializan las mallas.
-     * @param meshes Vector de componentes de malla que se van a establecer.
+     * @param meshes Vector de componentes de malla que se mueve al actor.
      */
     void
-    setMesh(Device& device, std::vector<MeshComponent> meshes);
+    setMesh(Device& device, std::vector<MeshComponent>&& meshes);
 
-    std::string
-    getName() {
+    /**
+     * @brief Establece las mallas del actor copiando las de la vista.
+     * @param device El dispositivo con el cual se inicializan las mallas.
+     * @param meshes Vista de las mallas; el actor guarda su propia copia.
+     */
+    void
+    setMesh(Device& device, EU::TArrayView<const MeshComponent> meshes);
+
+    /**
+     * @brief Obtiene el nombre internado del actor.
+     * @return Referencia al nombre; no reserva memoria.
+     */
+    const EU::TName&
+    getName() const {
         return m_name;
     }
 
+    /**
+     * @brief Establece el nombre del actor.
+     * @param name Nombre internado del actor.
+     */
     void
-    setName(const std::string& name) {
+    setName(const EU::TName& name) {
         m_name = name;
     }
 
     /**
-     * @brief Establece las texturas del actor.
-     * @param textures Vector de texturas que se van a establecer.
+     * @brief Establece las texturas del actor tomando posesión del vector.
+     * @param textures Vector de texturas que se mueve al actor.
+     */
+    void
+    setTextures(std::vector<Texture>&& textures) {
+        m_textures = std::move(textures);
+    }
+
+    /**
+     * @brief Establece las texturas del actor copiando las de la vista.
+     * @param textures Vista de las texturas que se van a establecer.
      */
     void
-    setTextures(std::vector<Texture> textures) {
-        m_textures = textures;
+    setTextures(EU::TArrayView<const Texture> textures) {
+        m_textures.assign(textures.begin(), textures.end());
     }
 
+    /**
+     * @brief Añade o quita el componente ShadowCaster, que decide si el actor entra en la pasada de sombras.
+     */
     void
     setCastShadow(bool v) {
-        castShadow = v;
+        if (v) {
+            addComponent<ShadowCaster>();
+        } else {
+            removeComponent<ShadowCaster>();
+        }
     }
 
     bool
     canCastShadow() const {
-        return castShadow;
+        return hasComponent<ShadowCaster>();
     }
 
     void
     renderShadow(DeviceContext& deviceContext);
 
 private:
+    /**
+     * @brief Recalcula la matriz de sombra proyectada en m_cbShadow.
+     * @param transform Transform del actor
+     */
+    void
+    computeShadowMatrix(const Transform& transform);
+
+    /**
+     * @brief Copia los handles de los buffers actuales en m_draws y en el componente MeshRenderer.
+     */
+    void
+    updateMeshRenderer();
+
     std::vector<MeshComponent> m_meshes; ///< Vector de componentes de malla.
     std::vector<Texture> m_textures; ///< Vector de texturas.
     std::vector<Buffer> m_vertexBuffers; ///< Buffers de vértices.
     std::vector<Buffer> m_indexBuffers; ///< Buffers de índices.
+    std::vector<MeshDraw> m_draws; ///< Handles de cada submalla; MeshRenderer apunta aquí.
     BlendState m_blendstate;
     Rasterizer m_rasterizer;
     SamplerState m_sampler;
@@ -138,7 +203,12 @@ private:
     CBChangesEveryFrame m_cbShadow;
 
     XMFLOAT4 m_LightPos;
-    std::string m_name = "Actor"; ///< Nombre del actor.
-    bool castShadow = true; ///< Indica si el actor proyecta sombras.
+    EU::TName m_name = "Actor"; ///< Nombre del actor.
     bool m_receiveShadow = true; ///< Indica si el actor recibe sombras (para el PS).
+    bool m_modelDirty = true; ///< El buffer del modelo debe subirse aunque el Transform no cambie.
+    uint32_t m_modelVersion = 0; ///< Versión del Transform preparada en m_model.
+    uint32_t m_shadowVersion = 0; ///< Versión del Transform preparada en m_cbShadow.
+    bool m_shadowDirty = true; ///< El buffer de sombra debe recalcularse.
+    bool m_modelPending = false; ///< m_model cambió y falta subirlo.
+    bool m_shadowPending = false; ///< m_cbShadow cambió y falta subirlo.
 };
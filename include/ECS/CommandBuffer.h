@@ -0,0 +1,193 @@
+﻿#pragma once
+#include "Prerequisites.h"
+#include "World.h"
+#include <atomic>
+#include <mutex>
+
+/**
+ * @brief Cambios estructurales del mundo grabados para aplicarlos más tarde.
+ *
+ * Crear o destruir entidades y añadir o quitar componentes mueve filas entre chunks e invalida
+ * punteros, así que no puede hacerse mientras otros hilos recorren el mundo. Un sistema graba
+ * esos cambios aquí y playback() los aplica todos juntos, en orden de grabación, en el punto de
+ * sincronización del frame. Los componentes y comandos diferidos se guardan en un
+ * EU::TStackAllocator que se vacía en cada playback, así que tras los primeros frames grabar
+ * no pide memoria al heap.
+ *
+ * Cada buffer lo usa un solo hilo (ver EntityCommandQueue).
+ */
+class
+EntityCommandBuffer {
+public:
+    EntityCommandBuffer() : m_storage(16 * 1024, EU::EMemoryTag::ECS) {}
+
+    ~EntityCommandBuffer() { clear(); }
+
+    EntityCommandBuffer(const EntityCommandBuffer&) = delete;
+    EntityCommandBuffer&
+    operator=(const EntityCommandBuffer&) = delete;
+
+    /**
+     * @brief Graba la creación de una entidad.
+     * @return Identificador provisional; solo vale para otros comandos de este mismo buffer.
+     */
+    EntityID
+    createEntity() {
+        EntityID entity;
+        entity.index = PendingBit | m_pendingCount++;
+        push(Op::Create, entity, 0, nullptr);
+        return entity;
+    }
+
+    /**
+     * @brief Graba la destrucción de una entidad (real o provisional).
+     */
+    void
+    destroyEntity(EntityID entity) {
+        push(Op::Destroy, entity, 0, nullptr);
+    }
+
+    /**
+     * @brief Graba la construcción de un componente; el valor se construye ya en el buffer y se
+     * mueve al chunk en playback(). Si la entidad ya tenía el componente, se reemplaza.
+     */
+    template <typename T, typename... Args>
+    void
+    addComponent(EntityID entity, Args&&... args) {
+        ComponentRegistry::ensureRegistered<T>();
+        void* payload = m_storage.allocate(sizeof(T), alignof(T));
+        ::new (payload) T(std::forward<Args>(args)...);
+        push(Op::Add, entity, ComponentRegistry::getID<T>(), payload);
+    }
+
+    /**
+     * @brief Graba la eliminación de un componente.
+     */
+    template <typename T>
+    void
+    removeComponent(EntityID entity) {
+        push(Op::Remove, entity, ComponentRegistry::getID<T>(), nullptr);
+    }
+
+    /**
+     * @brief Graba una operación arbitraria que se ejecuta como func(World&) en playback(), en
+     * orden con el resto de comandos. Sirve para cambios que no son de un solo componente, como
+     * crear un Actor con sus recursos. func no debe grabar en este mismo buffer.
+     */
+    template <typename Func>
+    void
+    defer(Func&& func) {
+        using FuncType = typename std::decay<Func>::type;
+        void* payload = m_storage.allocate(sizeof(FuncType), alignof(FuncType));
+        ::new (payload) FuncType(std::forward<Func>(func));
+        Command& command = push(Op::Custom, EntityID(), 0, payload);
+        command.invoke = [](void* callable, World& world) { (*static_cast<FuncType*>(callable))(world); };
+        command.destroy = [](void* callable) { static_cast<FuncType*>(callable)->~FuncType(); };
+    }
+
+    /**
+     * @brief Aplica los comandos en orden de grabación y vacía el buffer.
+     */
+    void
+    playback(World& world);
+
+    /**
+     * @brief Descarta los comandos sin aplicarlos.
+     */
+    void
+    clear();
+
+    bool
+    isEmpty() const { return m_commands.empty(); }
+
+    size_t
+    getCommandCount() const { return m_commands.size(); }
+
+private:
+    /**
+     * @brief Marca de los identificadores provisionales devueltos por createEntity().
+     */
+    static constexpr uint32_t PendingBit = 0x80000000u;
+
+    enum class Op : uint8_t {
+        Create,
+        Destroy,
+        Add,
+        Remove,
+        Custom
+    };
+
+    struct Command {
+        Op op = Op::Create; ///< Operación.
+        EntityID entity; ///< Entidad afectada (puede ser provisional).
+        ComponentTypeID type = 0; ///< Tipo de componente de Add y Remove.
+        void* payload = nullptr; ///< Componente (Add) o invocable (Custom) en m_storage.
+        void (*invoke)(void*, World&) = nullptr; ///< Ejecuta el invocable de Custom.
+        void (*destroy)(void*) = nullptr; ///< Destruye el invocable de Custom.
+    };
+
+    Command&
+    push(Op op, EntityID entity, ComponentTypeID type, void* payload) {
+        m_commands.emplace_back();
+        Command& command = m_commands.back();
+        command.op = op;
+        command.entity = entity;
+        command.type = type;
+        command.payload = payload;
+        return command;
+    }
+
+    /**
+     * @brief Traduce un identificador provisional a la entidad creada en este playback.
+     */
+    EntityID
+    resolve(EntityID entity) const {
+        return (entity.index & PendingBit) ? m_created[entity.index & ~PendingBit] : entity;
+    }
+
+    std::vector<Command> m_commands; ///< Comandos en orden de grabación.
+    std::vector<EntityID> m_created; ///< Entidades creadas en el playback en curso, por índice provisional.
+    EU::TStackAllocator m_storage; ///< Componentes e invocables pendientes.
+    uint32_t m_pendingCount = 0; ///< Identificadores provisionales repartidos.
+};
+
+/**
+ * @brief Un EntityCommandBuffer por hilo, para grabar desde sistemas en paralelo sin bloqueos.
+ *
+ * getBuffer() devuelve el buffer del hilo que llama; solo la primera llamada de cada hilo toma
+ * un mutex para crearlo. playback() aplica los buffers uno detrás de otro en el hilo principal,
+ * en el punto de sincronización del frame.
+ */
+class
+EntityCommandQueue {
+public:
+    EntityCommandQueue() : m_id(nextQueueID().fetch_add(1, std::memory_order_relaxed) + 1) {}
+
+    EntityCommandQueue(const EntityCommandQueue&) = delete;
+    EntityCommandQueue&
+    operator=(const EntityCommandQueue&) = delete;
+
+    /**
+     * @brief Buffer del hilo actual.
+     */
+    EntityCommandBuffer&
+    getBuffer();
+
+    /**
+     * @brief Aplica y vacía los buffers de todos los hilos. No debe solaparse con la grabación.
+     */
+    void
+    playback(World& world);
+
+private:
+    static std::atomic<uint64_t>&
+    nextQueueID() {
+        static std::atomic<uint64_t> s_next{ 0 };
+        return s_next;
+    }
+
+    uint64_t m_id; ///< Identifica la cola en la caché por hilo (una dirección podría reutilizarse).
+    std::mutex m_mutex; ///< Protege m_buffers al crear el buffer de un hilo nuevo.
+    std::vector<EU::TUniquePtr<EntityCommandBuffer>> m_buffers; ///< Un buffer por hilo que ha grabado.
+    std::vector<std::thread::id> m_threads; ///< Hilo dueño de cada buffer.
+};
\ No newline at end of file
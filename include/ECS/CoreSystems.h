@@ -0,0 +1,50 @@
+﻿#pragma once
+#include "Prerequisites.h"
+#include "System.h"
+
+class Actor;
+
+/**
+ * @brief Aplica los cambios pendientes de cada Transform y entrega su transformación local al SceneGraph.
+ */
+class
+TransformSystem : public System {
+public:
+    TransformSystem();
+
+    void
+    update(World& world, EU::TThreadPool& pool, float deltaTime) override;
+};
+
+/**
+ * @brief Propaga las matrices de mundo por la jerarquía, repartiendo las raíces entre los trabajadores.
+ * Las matrices de mundo se consideran datos del Transform, por eso declara escritura sobre él.
+ */
+class
+SceneGraphSystem : public System {
+public:
+    SceneGraphSystem();
+
+    void
+    update(World& world, EU::TThreadPool& pool, float deltaTime) override;
+};
+
+/**
+ * @brief Parte de CPU de la actualización de los actores (Actor::updateCPU) en paralelo.
+ * La subida a la GPU (Actor::uploadGPU) queda fuera, en el hilo del contexto inmediato.
+ */
+class
+ActorSystem : public System {
+public:
+    /**
+     * @param actors Actores de la escena; el vector debe sobrevivir al sistema.
+     */
+    explicit
+    ActorSystem(std::vector<EU::TRefPtr<Actor>>& actors);
+
+    void
+    update(World& world, EU::TThreadPool& pool, float deltaTime) override;
+
+private:
+    std::vector<EU::TRefPtr<Actor>>& m_actors; ///< Actores de la escena (no propios).
+};
\ No newline at end of file
@@ -1,19 +1,38 @@
 ﻿#pragma once
 #include "Prerequisites.h"
 #include "Component.h"
+#include "World.h"
 
 class DeviceContext;
 
+/**
+ * @brief Entidad base del ECS. Lleva su propio recuento de referencias (EU::RefCounted) para
+ * que la escena y la interfaz la compartan mediante EU::TRefPtr sin bloques de control aparte.
+ * Sus componentes no viven en la entidad sino en los chunks del World al que pertenece.
+ */
 class
-Entity {
+Entity : public EU::RefCounted {
 public:
     Entity() = default;
 
     /**
-   * @brief Destructor virtual.
+     * @brief Crea la entidad en el mundo indicado, que debe sobrevivir a la entidad.
+     * @param world Mundo que almacena los componentes.
+     */
+    explicit
+    Entity(World& world) :
+        m_world(&world), m_entityID(world.createEntity()) {
+    }
+
+    /**
+   * @brief Destructor virtual. Destruye la entidad del mundo junto con sus componentes.
    */
     virtual
-    ~Entity() = default;
+    ~Entity() {
+        if (m_world) {
+            m_world->destroyEntity(m_entityID);
+        }
+    }
 
     /**
      * @brief Initialize the entity with a device context.
@@ -44,37 +63,52 @@ public:
     destroy() = 0;
 
     /**
-     * @brief Agrega un componente a la entidad.
-     * @tparam T Tipo del componente, debe derivar de Component.
-     * @param component Puntero compartido al componente que se va a agregar.
+     * @brief Construye un componente de la entidad dentro de su chunk en el mundo.
+     * @tparam T Tipo del componente.
+     * @param args Argumentos del constructor del componente.
+     * @return Puntero no propietario al componente agregado.
+     */
+    template <typename T, typename... Args>
+    T*
+    addComponent(Args&&... args) {
+        return m_world->addComponent<T>(m_entityID, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Destruye un componente de la entidad.
+     * @tparam T Tipo del componente a quitar.
      */
     template <typename T>
     void
-    addComponent(EU::TSharedPointer<T> component) {
-        static_assert(std::is_base_of<Component, T>::value, "T must be derived from Component");
-        m_components.push_back(component.template dynamic_pointer_cast<Component>());
+    removeComponent() {
+        m_world->removeComponent<T>(m_entityID);
     }
 
     /**
      * @brief Obtiene un componente de la entidad por su tipo.
      * @tparam T Tipo del componente a obtener.
-     * @return Puntero compartido al componente si se encuentra, nullptr en caso contrario.
+     * @return Puntero no propietario al componente si se encuentra, nullptr en caso contrario.
+     *         Es válido hasta el siguiente cambio estructural del mundo.
        */
     template <typename T>
-    EU::TSharedPointer<T>
+    T*
     getComponent() {
-        for (auto& component : m_components) {
-            EU::TSharedPointer<T> specificComponent = component.template dynamic_pointer_cast<T>();
-            if (specificComponent) {
-                return specificComponent;
-            }
-        }
-        return EU::TSharedPointer<T>();
+        return m_world ? m_world->getComponent<T>(m_entityID) : nullptr;
     }
 
+    template <typename T>
+    bool
+    hasComponent() const {
+        return m_world && m_world->hasComponent<T>(m_entityID);
+    }
+
+    EntityID
+    getEntityID() const { return m_entityID; }
+
 private:
 protected:
     bool m_isActive;
     int m_id;
-    std::vector<EU::TSharedPointer<Component>> m_components;
+    World* m_world = nullptr; ///< Mundo que guarda los componentes (no propio).
+    EntityID m_entityID; ///< Identificador de la entidad en m_world.
 };
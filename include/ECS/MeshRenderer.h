@@ -0,0 +1,29 @@
+﻿#pragma once
+#include "Prerequisites.h"
+
+/**
+ * @brief Lo necesario para emitir el draw de una submalla: buffers de vértices e índices y número de índices.
+ */
+struct
+MeshDraw {
+    ID3D11Buffer* vertexBuffer = nullptr; ///< Buffer de vértices (no propio).
+    unsigned int stride = 0; ///< Bytes por vértice.
+    ID3D11Buffer* indexBuffer = nullptr; ///< Buffer de índices R32_UINT (no propio).
+    unsigned int indexCount = 0; ///< Índices a dibujar.
+};
+
+/**
+ * @brief Datos de dibujo de una entidad con malla, guardados en el chunk.
+ *
+ * Solo contiene handles de GPU que pertenecen al actor: las pasadas que recorren el mundo con
+ * una consulta (p. ej. la de sombras) dibujan sin tocar el objeto Actor. El actor actualiza el
+ * componente cada vez que crea o libera sus buffers.
+ */
+struct
+MeshRenderer {
+    static constexpr ComponentType StaticType = ComponentType::MESH_RENDERER;
+
+    ID3D11Buffer* modelBuffer = nullptr; ///< Buffer constante con world y color (slot 2).
+    const MeshDraw* draws = nullptr; ///< Submallas, en un array contiguo que mantiene el actor.
+    unsigned int drawCount = 0; ///< Número de submallas.
+};
\ No newline at end of file
@@ -0,0 +1,183 @@
+﻿#pragma once
+#include "Prerequisites.h"
+#include "TransformKernel.h"
+#include <cassert>
+
+/**
+ * @brief Identificador estable de un nodo de SceneGraph (no cambia al reordenar los arrays).
+ */
+using SceneNodeID = uint32_t;
+
+/**
+ * @brief Nodo nulo: sin padre o sin nodo asignado.
+ */
+constexpr SceneNodeID InvalidSceneNode = 0xFFFFFFFFu;
+
+/**
+ * @brief Jerarquía de transformaciones padre/hijo guardada en arrays planos.
+ *
+ * Los nodos se guardan en preorden: cada padre va antes que sus hijos y cada subárbol ocupa un
+ * rango contiguo, de modo que las matrices de mundo se calculan en una sola pasada lineal
+ * (world = local * world del padre) y un subárbol sin cambios se salta de un salto. Cada raíz
+ * es un rango independiente, así que updateRoots() puede repartir raíces entre hilos.
+ *
+ * La transformación local se guarda en SoA (posición, cuaternión y escala, un array por
+ * componente) y las matrices locales se componen por bloques SIMD con ComposeTransforms().
+ *
+ * Los cambios estructurales (crear, destruir o reparentar) solo marcan el orden como inválido;
+ * los arrays se reordenan una vez en la siguiente actualización.
+ */
+class
+SceneGraph {
+public:
+    SceneGraph() = default;
+
+    SceneGraph(const SceneGraph&) = delete;
+    SceneGraph&
+    operator=(const SceneGraph&) = delete;
+
+    /**
+     * @brief Crea un nodo con matriz local identidad.
+     * @param parent Nodo padre o InvalidSceneNode para crear una raíz.
+     */
+    SceneNodeID
+    createNode(SceneNodeID parent = InvalidSceneNode);
+
+    /**
+     * @brief Destruye el nodo; sus hijos pasan a colgar del padre del nodo destruido.
+     */
+    void
+    destroyNode(SceneNodeID node);
+
+    /**
+     * @brief Cambia el padre de un nodo. Se ignora si crearía un ciclo.
+     * @param parent Nuevo padre o InvalidSceneNode para convertirlo en raíz.
+     */
+    void
+    setParent(SceneNodeID node, SceneNodeID parent);
+
+    SceneNodeID
+    getParent(SceneNodeID node) const { return m_nodes[node].parent; }
+
+    /**
+     * @brief Asigna la transformación local y marca el nodo (y su subárbol) para recalcular.
+     * @param rotation Cuaternión normalizado (x, y, z, w).
+     */
+    void
+    setLocalTransform(SceneNodeID node, const XMFLOAT3& position, const XMFLOAT4& rotation, const XMFLOAT3& scale);
+
+    const XMMATRIX&
+    getLocalMatrix(SceneNodeID node) const { return m_local[m_nodes[node].slot]; }
+
+    /**
+     * @brief Matriz de mundo calculada en la última actualización.
+     */
+    const XMMATRIX&
+    getWorldMatrix(SceneNodeID node) const { return m_world[m_nodes[node].slot]; }
+
+    /**
+     * @brief Se incrementa cada vez que cambia la matriz de mundo del nodo.
+     */
+    uint32_t
+    getWorldVersion(SceneNodeID node) const { return m_version[m_nodes[node].slot]; }
+
+    /**
+     * @brief Recalcula las matrices de mundo de todos los nodos con cambios.
+     */
+    void
+    update();
+
+    /**
+     * @brief Reordena los arrays si hubo cambios estructurales. Debe llamarse antes de
+     * repartir updateRoots() entre hilos.
+     */
+    void
+    prepareUpdate();
+
+    /**
+     * @brief Recalcula los subárboles de las raíces [first, last). Rangos disjuntos pueden
+     * procesarse en paralelo tras prepareUpdate().
+     */
+    void
+    updateRoots(size_t first, size_t last);
+
+    size_t
+    getRootCount() const { return m_roots.size(); }
+
+    size_t
+    getNodeCount() const { return m_nodes.size() - m_freeNodes.size(); }
+
+private:
+    /**
+     * @brief Enlaces del árbol por identificador; solo se usan al reordenar.
+     */
+    struct NodeLinks {
+        SceneNodeID parent = InvalidSceneNode; ///< Nodo padre.
+        SceneNodeID firstChild = InvalidSceneNode; ///< Primer hijo.
+        SceneNodeID nextSibling = InvalidSceneNode; ///< Siguiente hermano.
+        uint32_t slot = 0; ///< Posición en los arrays ordenados.
+        bool alive = false; ///< false si el identificador está libre.
+    };
+
+    void
+    linkChild(SceneNodeID parent, SceneNodeID child);
+
+    void
+    unlinkChild(SceneNodeID parent, SceneNodeID child);
+
+    /**
+     * @brief Añade al final de los arrays SoA un slot con la transformación identidad.
+     */
+    void
+    pushIdentity();
+
+    /**
+     * @brief Compone las matrices locales de los bloques del rango [begin, end) con nodos marcados.
+     */
+    void
+    composeLocals(uint32_t begin, uint32_t end);
+
+    /**
+     * @brief Marca el nodo del slot indicado y sus ancestros como subárbol con cambios.
+     */
+    void
+    markDirty(uint32_t slot);
+
+    /**
+     * @brief Recoloca los arrays en preorden y recalcula padres, tamaños de subárbol y raíces.
+     */
+    void
+    rebuildOrder();
+
+    std::vector<NodeLinks> m_nodes; ///< Enlaces por identificador de nodo.
+    std::vector<SceneNodeID> m_freeNodes; ///< Identificadores libres para reutilizar.
+
+    // Arrays ordenados en preorden (indexados por slot)
+    EU::TAlignedVector<float, EU::SimdAlignment, EU::EMemoryTag::ECS> m_positionX; ///< Posición local (SoA).
+    EU::TAlignedVector<float, EU::SimdAlignment, EU::EMemoryTag::ECS> m_positionY;
+    EU::TAlignedVector<float, EU::SimdAlignment, EU::EMemoryTag::ECS> m_positionZ;
+    EU::TAlignedVector<float, EU::SimdAlignment, EU::EMemoryTag::ECS> m_rotationX; ///< Rotación local en cuaternión (SoA).
+    EU::TAlignedVector<float, EU::SimdAlignment, EU::EMemoryTag::ECS> m_rotationY;
+    EU::TAlignedVector<float, EU::SimdAlignment, EU::EMemoryTag::ECS> m_rotationZ;
+    EU::TAlignedVector<float, EU::SimdAlignment, EU::EMemoryTag::ECS> m_rotationW;
+    EU::TAlignedVector<float, EU::SimdAlignment, EU::EMemoryTag::ECS> m_scaleX; ///< Escala local (SoA).
+    EU::TAlignedVector<float, EU::SimdAlignment, EU::EMemoryTag::ECS> m_scaleY;
+    EU::TAlignedVector<float, EU::SimdAlignment, EU::EMemoryTag::ECS> m_scaleZ;
+    EU::TAlignedVector<XMMATRIX, EU::SimdAlignment, EU::EMemoryTag::ECS> m_local; ///< Matriz local compuesta.
+    EU::TAlignedVector<XMMATRIX, EU::SimdAlignment, EU::EMemoryTag::ECS> m_world; ///< Matriz de mundo.
+    std::vector<int32_t> m_parentSlot; ///< Slot del padre o -1 en las raíces.
+    std::vector<uint32_t> m_subtreeSize; ///< Nodos del subárbol incluido el propio nodo.
+    std::vector<uint32_t> m_version; ///< Versión de la matriz de mundo.
+    std::vector<SceneNodeID> m_slotNode; ///< Nodo que ocupa el slot (InvalidSceneNode si está libre).
+    std::vector<uint8_t> m_dirty; ///< La transformación local cambió.
+    std::vector<uint8_t> m_subtreeDirty; ///< Algún nodo del subárbol cambió.
+    std::vector<uint8_t> m_changed; ///< La matriz de mundo cambió en la pasada actual.
+    std::vector<uint32_t> m_roots; ///< Slot de cada raíz.
+
+    // Memoria de trabajo de rebuildOrder, conservada entre llamadas
+    std::vector<uint32_t> m_order;
+    std::vector<SceneNodeID> m_stack;
+    EU::TAlignedVector<float, EU::SimdAlignment, EU::EMemoryTag::ECS> m_scratch;
+
+    bool m_orderDirty = false; ///< Hubo cambios estructurales desde el último reordenado.
+};
\ No newline at end of file
@@ -0,0 +1,11 @@
+﻿#pragma once
+#include "Prerequisites.h"
+
+/**
+ * @brief Marca las entidades que proyectan sombra. No tiene datos: solo filtra consultas
+ * (World::query); lo que se dibuja en la pasada de sombras se lee de MeshRenderer.
+ */
+struct
+ShadowCaster {
+    static constexpr ComponentType StaticType = ComponentType::SHADOW_CASTER;
+};
\ No newline at end of file
@@ -0,0 +1,70 @@
+﻿#pragma once
+#include "Prerequisites.h"
+#include "World.h"
+
+/**
+ * @brief Sistema del ECS: lógica que recorre los componentes del mundo una vez por frame.
+ *
+ * Cada sistema declara en su constructor qué tipos de componente lee (reads<Ts...>()) y cuáles
+ * escribe (writes<Ts...>()). SystemScheduler usa esas máscaras para ordenar los sistemas y
+ * ejecutar en paralelo los que no entran en conflicto; con ECS_CHECK_ACCESS el World avisa si
+ * un sistema toca un tipo que no declaró (se comprueba en el hilo que ejecuta update(), no en
+ * los trabajadores de un parallelFor interno).
+ */
+class
+System {
+public:
+    virtual
+    ~System() = default;
+
+    /**
+     * @brief Ejecuta el sistema sobre el mundo.
+     * @param world Mundo con los componentes.
+     * @param pool Trabajadores para paralelizar dentro del sistema.
+     * @param deltaTime Tiempo transcurrido desde el frame anterior.
+     */
+    virtual void
+    update(World& world, EU::TThreadPool& pool, float deltaTime) = 0;
+
+    const char*
+    getName() const { return m_access.system; }
+
+    const SystemAccess&
+    getAccess() const { return m_access; }
+
+    /**
+     * @brief Indica si dos sistemas no pueden ejecutarse a la vez: uno escribe algo que el otro lee o escribe.
+     */
+    bool
+    conflictsWith(const System& other) const {
+        return (m_access.writes & (other.m_access.reads | other.m_access.writes)) != 0 ||
+               (m_access.reads & other.m_access.writes) != 0;
+    }
+
+protected:
+    explicit
+    System(const char* name) {
+        m_access.system = name;
+    }
+
+    /**
+     * @brief Declara tipos de componente que el sistema solo lee.
+     */
+    template <typename... Ts>
+    void
+    reads() {
+        m_access.reads |= (ComponentRegistry::getMask<Ts>() | ... | ComponentMask(0));
+    }
+
+    /**
+     * @brief Declara tipos de componente que el sistema modifica.
+     */
+    template <typename... Ts>
+    void
+    writes() {
+        m_access.writes |= (ComponentRegistry::getMask<Ts>() | ... | ComponentMask(0));
+    }
+
+private:
+    SystemAccess m_access; ///< Acceso declarado.
+};
\ No newline at end of file
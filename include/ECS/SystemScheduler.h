@@ -0,0 +1,71 @@
+﻿#pragma once
+#include "Prerequisites.h"
+#include "System.h"
+
+/**
+ * @brief Ejecuta los sistemas registrados respetando sus dependencias de acceso.
+ *
+ * Entre dos sistemas que entran en conflicto (ver System::conflictsWith) manda el orden de
+ * registro: el que se añadió antes se ejecuta antes. Con esas aristas se forma un DAG que se
+ * divide en niveles; los sistemas de un mismo nivel no comparten escrituras y se reparten
+ * entre los hilos del pool. Un nivel con un solo sistema se ejecuta en el hilo que llama, de
+ * modo que el sistema puede usar el pool para su propio parallelFor.
+ */
+class
+SystemScheduler {
+public:
+    explicit
+    SystemScheduler(EU::TThreadPool& pool) : m_pool(pool) {}
+
+    SystemScheduler(const SystemScheduler&) = delete;
+    SystemScheduler&
+    operator=(const SystemScheduler&) = delete;
+
+    /**
+     * @brief Crea y registra un sistema; se ejecuta después de los registrados antes con los que choque.
+     * @return Puntero no propietario al sistema.
+     */
+    template <typename T, typename... Args>
+    T*
+    addSystem(Args&&... args) {
+        EU::TUniquePtr<T> system = EU::MakeUnique<T>(std::forward<Args>(args)...);
+        T* result = system.get();
+        m_systems.push_back(EU::TUniquePtr<System>(std::move(system)));
+        m_graphDirty = true;
+        return result;
+    }
+
+    /**
+     * @brief Ejecuta todos los sistemas una vez.
+     */
+    void
+    run(World& world, float deltaTime);
+
+    size_t
+    getSystemCount() const { return m_systems.size(); }
+
+    /**
+     * @brief Número de niveles del DAG (pasos que no pueden solaparse).
+     */
+    size_t
+    getLevelCount() const { return m_levelStart.empty() ? 0 : m_levelStart.size() - 1; }
+
+private:
+    /**
+     * @brief Construye el DAG y ordena los sistemas por nivel.
+     */
+    void
+    buildGraph();
+
+    /**
+     * @brief Ejecuta un sistema declarando su acceso en el hilo actual.
+     */
+    void
+    runSystem(System& system, World& world, float deltaTime);
+
+    EU::TThreadPool& m_pool; ///< Hilos para ejecutar sistemas en paralelo.
+    std::vector<EU::TUniquePtr<System>> m_systems; ///< Sistemas en orden de registro.
+    std::vector<System*> m_ordered; ///< Sistemas ordenados por nivel.
+    std::vector<size_t> m_levelStart; ///< Inicio de cada nivel en m_ordered (más un final).
+    bool m_graphDirty = false; ///< Se añadieron sistemas desde el último buildGraph().
+};
\ No newline at end of file
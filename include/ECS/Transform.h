@@ -2,17 +2,20 @@
 #include "Prerequisites.h"
 #include "EngineUtilities\Vectors\Vector3.h"
 #include "Component.h"
+#include "SceneGraph.h"
 
 class
 Transform : public Component {
 public:
+    static constexpr ComponentType StaticType = ComponentType::TRANSFORM;
+
     // Constructor que inicializa posición, rotación y escala por defecto
     Transform() :
         position(),
         rotation(),
         scale(),
-        matrix(),
-        Component(ComponentType::TRANSFORM) {
+        matrix(XMMatrixIdentity()),
+        Component(StaticType) {
     }
 
     // Métodos para inicialización, actualización, renderizado y destrucción
@@ -20,7 +23,7 @@ public:
     void
     init();
 
-    // Actualiza el estado del objeto Transform basado en el tiempo transcurrido
+    // Recalcula la matriz solo si algún setter la marcó como sucia
     // @param deltaTime: Tiempo transcurrido desde la última actualización
     void
     update(float deltaTime) override;
@@ -43,16 +46,21 @@ public:
 
     // Establece una nueva posición
     void
-    setPosition(const EU::Vector3& newPos) { position = newPos; }
+    setPosition(const EU::Vector3& newPos) { position = newPos; m_dirty = true; }
 
     // Métodos de acceso a los datos de rotación
     // Retorna la rotación actual
     const EU::Vector3&
     getRotation() const { return rotation; }
 
-    // Establece una nueva rotación
+    // Establece una nueva rotación en ángulos de Euler (pitch, yaw, roll en radianes);
+    // el cuaternión que usa el SceneGraph se recalcula solo aquí, no en cada frame
     void
-    setRotation(const EU::Vector3& newRot) { rotation = newRot; }
+    setRotation(const EU::Vector3& newRot);
+
+    // Rotación en cuaternión (x, y, z, w)
+    const XMFLOAT4&
+    getOrientation() const { return m_orientation; }
 
     // Métodos de acceso a los datos de escala
     // Retorna la escala actual
@@ -61,7 +69,7 @@ public:
 
     // Establece una nueva escala
     void
-    setScale(const EU::Vector3& newScale) { scale = newScale; }
+    setScale(const EU::Vector3& newScale) { scale = newScale; m_dirty = true; }
 
     void
     setTransform(const EU::Vector3& newPos,
@@ -73,11 +81,53 @@ public:
     void
     translate(const EU::Vector3& translation);
 
+    // Indica si hay cambios pendientes de aplicar a la matriz
+    bool
+    isDirty() const { return m_dirty; }
+
+    // Se incrementa cada vez que la matriz se recalcula; quien sube la matriz
+    // a la GPU compara contra la última versión que subió para saltarse el upload
+    uint32_t
+    getVersion() const { return m_version; }
+
+    // Enlaza el Transform con su nodo en la jerarquía; a partir de entonces update()
+    // entrega posición, cuaternión y escala al SceneGraph, que compone las matrices
+    void
+    setSceneNode(SceneGraph* graph, SceneNodeID node) { m_graph = graph; m_node = node; m_dirty = true; }
+
+    SceneNodeID
+    getSceneNode() const { return m_node; }
+
+    // Cuelga este Transform de otro (nullptr para dejarlo como raíz)
+    void
+    setParent(const Transform* parent);
+
+    // Matriz de mundo del padre (identidad si es raíz o no hay jerarquía)
+    XMMATRIX
+    getParentWorldMatrix() const;
+
+    // Matriz de mundo: la del SceneGraph si el Transform tiene nodo, si no la local
+    const XMMATRIX&
+    getWorldMatrix() const { return m_graph ? m_graph->getWorldMatrix(m_node) : matrix; }
+
+    // Versión de la matriz de mundo, para saltarse uploads sin cambios
+    uint32_t
+    getWorldVersion() const { return m_graph ? m_graph->getWorldVersion(m_node) : m_version; }
+
 private:
+    // Convierte los ángulos de Euler de rotation a m_orientation
+    void
+    updateOrientation();
+
     EU::Vector3 position; // Posición del objeto
-    EU::Vector3 rotation; // Rotación del objeto
+    EU::Vector3 rotation; // Rotación del objeto en ángulos de Euler (para la UI)
     EU::Vector3 scale; // Escala del objeto
+    XMFLOAT4 m_orientation = XMFLOAT4(0.0f, 0.0f, 0.0f, 1.0f); // Rotación en cuaternión
+    bool m_dirty = true; // La matriz no refleja posición/rotación/escala
+    uint32_t m_version = 0; // Número de veces que se ha recalculado la matriz
+    SceneGraph* m_graph = nullptr; // Jerarquía a la que pertenece (no propia)
+    SceneNodeID m_node = InvalidSceneNode; // Nodo en m_graph
 
 public:
-    XMMATRIX matrix; // Matriz de transformación
+    XMMATRIX matrix; // Matriz local (solo si el Transform no pertenece a un SceneGraph)
 };
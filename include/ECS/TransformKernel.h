@@ -0,0 +1,38 @@
+﻿#pragma once
+#include "Prerequisites.h"
+
+/**
+ * @brief Transformaciones por bloque: una iteración AVX o dos SSE, según la CPU en tiempo de ejecución.
+ */
+constexpr size_t TransformBatchSize = 8;
+
+/**
+ * @brief Transformaciones locales en SoA: un array por componente de posición, cuaternión y escala.
+ */
+struct TransformStreams {
+    const float* positionX = nullptr;
+    const float* positionY = nullptr;
+    const float* positionZ = nullptr;
+    const float* rotationX = nullptr; ///< Cuaternión normalizado (x, y, z, w).
+    const float* rotationY = nullptr;
+    const float* rotationZ = nullptr;
+    const float* rotationW = nullptr;
+    const float* scaleX = nullptr;
+    const float* scaleY = nullptr;
+    const float* scaleZ = nullptr;
+};
+
+/**
+ * @brief Compone matrices escala * rotación * traslación para los elementos [first, first + count).
+ *
+ * Cada carril SIMD calcula una transformación completa sin trigonometría (la rotación ya está en
+ * cuaternión), y las filas resultantes se trasponen a matrices AoS. Equivale a
+ * XMMatrixScaling * XMMatrixRotationQuaternion * XMMatrixTranslation.
+ *
+ * @param streams Arrays de entrada.
+ * @param first Primer elemento a componer.
+ * @param count Número de elementos.
+ * @param matrices Salida, indexada igual que las entradas (matrices[first] es el primero).
+ */
+void
+ComposeTransforms(const TransformStreams& streams, size_t first, size_t count, XMMATRIX* matrices);
\ No newline at end of file
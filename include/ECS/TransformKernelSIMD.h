@@ -0,0 +1,57 @@
+﻿#pragma once
+#include "ECS/TransformKernel.h"
+#include <immintrin.h>
+
+/**
+ * @brief Piezas internas de ComposeTransforms compartidas por el camino SSE y el AVX.
+ *
+ * Solo lo incluyen TransformKernel.cpp y TransformKernelAVX.cpp; el segundo se compila con
+ * /arch:AVX y solo se llama si la CPU admite AVX.
+ */
+namespace TransformKernelDetail {
+    /**
+     * @brief Escribe las filas de 4 matrices a partir de sus columnas en SoA (un carril por matriz).
+     *
+     * static: cada unidad conserva su propia copia; si el enlazador eligiera la compilada con
+     * AVX, el camino SSE ejecutaría instrucciones AVX en CPUs que no las tienen.
+     */
+    static inline void
+    storeRows(XMMATRIX* matrices,
+              __m128 m00, __m128 m01, __m128 m02,
+              __m128 m10, __m128 m11, __m128 m12,
+              __m128 m20, __m128 m21, __m128 m22,
+              __m128 tx, __m128 ty, __m128 tz) {
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+        __m128 w = zero;
+        _MM_TRANSPOSE4_PS(m00, m01, m02, w);
+        __m128 w1 = zero;
+        _MM_TRANSPOSE4_PS(m10, m11, m12, w1);
+        __m128 w2 = zero;
+        _MM_TRANSPOSE4_PS(m20, m21, m22, w2);
+        __m128 w3 = one;
+        _MM_TRANSPOSE4_PS(tx, ty, tz, w3);
+
+        const __m128 rows[4][4] = {
+            { m00, m10, m20, tx },
+            { m01, m11, m21, ty },
+            { m02, m12, m22, tz },
+            { w, w1, w2, w3 },
+        };
+        for (int i = 0; i < 4; ++i) {
+            float* out = reinterpret_cast<float*>(&matrices[i]);
+            _mm_store_ps(out, rows[i][0]);
+            _mm_store_ps(out + 4, rows[i][1]);
+            _mm_store_ps(out + 8, rows[i][2]);
+            _mm_store_ps(out + 12, rows[i][3]);
+        }
+    }
+}
+
+/**
+ * @brief Compone en bloques de 8 con AVX tantos elementos de [first, first + count) como llenen un bloque.
+ *
+ * @return Elementos compuestos (múltiplo de 8); el resto queda para el camino SSE.
+ */
+size_t
+ComposeTransformsAVX(const TransformStreams& streams, size_t first, size_t count, XMMATRIX* matrices);
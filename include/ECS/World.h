@@ -0,0 +1,621 @@
+﻿#pragma once
+#include "Prerequisites.h"
+#include "SceneGraph.h"
+#include <algorithm>
+#include <cassert>
+#include <type_traits>
+#include <utility>
+#include <xmmintrin.h>
+
+/**
+ * @brief Identificador de entidad: índice en la tabla de registros más una generación que
+ * invalida los identificadores de entidades ya destruidas cuyo índice se ha reutilizado.
+ */
+struct EntityID {
+    uint32_t index = 0xFFFFFFFFu; ///< Posición en la tabla de registros del mundo.
+    uint32_t generation = 0; ///< Generación del registro cuando se creó la entidad.
+
+    bool
+    isValid() const { return index != 0xFFFFFFFFu; }
+
+    bool
+    operator==(const EntityID& other) const { return index == other.index && generation == other.generation; }
+
+    bool
+    operator!=(const EntityID& other) const { return !(*this == other); }
+};
+
+using ComponentTypeID = uint32_t;
+
+/**
+ * @brief Conjunto de tipos de componente, un bit por valor de ComponentType.
+ */
+using ComponentMask = uint64_t;
+
+/**
+ * @brief Número máximo de tipos de componente distintos.
+ */
+constexpr uint32_t MaxComponentTypes = COMPONENT_TYPE_COUNT;
+static_assert(MaxComponentTypes <= 64, "ComponentMask holds at most 64 component types");
+
+/**
+ * @brief Si es 1, World comprueba que cada sistema solo toque los componentes que declaró
+ * (ver SystemAccess). Por defecto activo solo en Debug.
+ */
+#ifndef ECS_CHECK_ACCESS
+#ifdef _DEBUG
+#define ECS_CHECK_ACCESS 1
+#else
+#define ECS_CHECK_ACCESS 0
+#endif
+#endif
+
+/**
+ * @brief Componentes que un sistema declara leer y escribir.
+ */
+struct SystemAccess {
+    const char* system = ""; ///< Nombre del sistema, para los mensajes de error.
+    ComponentMask reads = 0; ///< Tipos que solo lee.
+    ComponentMask writes = 0; ///< Tipos que modifica (implica lectura).
+};
+
+/**
+ * @brief Operaciones de un tipo de componente necesarias para moverlo entre chunks sin conocer su tipo.
+ */
+struct ComponentInfo {
+    size_t size = 0; ///< sizeof del componente.
+    size_t alignment = 0; ///< alignof del componente.
+    void (*moveConstruct)(void* destination, void* source) = nullptr; ///< Construye en destination moviendo source.
+    void (*destroy)(void* component) = nullptr; ///< Llama al destructor.
+};
+
+/**
+ * @brief Identificadores de tipo de componente resueltos en compilación.
+ *
+ * Cada tipo declara `static constexpr ComponentType StaticType`, de modo que su identificador
+ * y su bit de máscara son constantes: buscar un componente no necesita RTTI ni tablas hash.
+ */
+class
+ComponentRegistry {
+public:
+    template <typename T>
+    static constexpr ComponentTypeID
+    getID() {
+        static_assert(T::StaticType > NONE && T::StaticType < COMPONENT_TYPE_COUNT, "Invalid component StaticType");
+        return static_cast<ComponentTypeID>(T::StaticType);
+    }
+
+    template <typename T>
+    static constexpr ComponentMask
+    getMask() {
+        return ComponentMask(1) << getID<T>();
+    }
+
+    /**
+     * @brief Registra las operaciones de T para moverlo entre chunks; solo hace falta una vez.
+     */
+    template <typename T>
+    static void
+    ensureRegistered() {
+        static const bool registered = registerType<T>();
+        (void)registered;
+    }
+
+    static const ComponentInfo&
+    getInfo(ComponentTypeID id) { return infos()[id]; }
+
+private:
+    template <typename T>
+    static bool
+    registerType() {
+        ComponentInfo& info = infos()[getID<T>()];
+        info.size = sizeof(T);
+        info.alignment = alignof(T);
+        info.moveConstruct = [](void* destination, void* source) {
+            ::new (destination) T(std::move(*static_cast<T*>(source)));
+        };
+        info.destroy = [](void* component) {
+            static_cast<T*>(component)->~T();
+        };
+        return true;
+    }
+
+    static ComponentInfo*
+    infos() {
+        static ComponentInfo s_infos[MaxComponentTypes];
+        return s_infos;
+    }
+};
+
+/**
+ * @brief Bloque de World::ChunkSize bytes con los datos de hasta Archetype::capacity entidades:
+ * primero el array de EntityID y después un array contiguo por cada tipo de componente.
+ */
+struct Chunk {
+    unsigned char* data = nullptr; ///< Memoria del chunk (del pool de chunks del mundo).
+    uint32_t count = 0; ///< Entidades vivas en el chunk.
+};
+
+/**
+ * @brief Conjunto de entidades que tienen exactamente los mismos tipos de componente.
+ */
+struct Archetype {
+    std::vector<ComponentTypeID> types; ///< Tipos de componente, ordenados.
+    ComponentMask mask = 0; ///< Los mismos tipos como máscara de bits.
+    int8_t columnIndex[MaxComponentTypes]; ///< Columna de cada tipo, o -1 si no lo tiene.
+    std::vector<size_t> columnOffsets; ///< Offset de la columna de cada tipo dentro del chunk.
+    std::vector<size_t> columnSizes; ///< sizeof de cada tipo.
+    uint32_t capacity = 0; ///< Entidades por chunk.
+    std::vector<Chunk> chunks; ///< Chunks llenos salvo el último.
+    size_t entityCount = 0; ///< Entidades en todo el arquetipo.
+    Archetype* addEdges[MaxComponentTypes]; ///< Caché del arquetipo destino al añadir cada tipo.
+    Archetype* removeEdges[MaxComponentTypes]; ///< Caché del arquetipo destino al quitar cada tipo.
+
+    /**
+     * @brief Columna del tipo indicado, o -1 si el arquetipo no lo tiene.
+     */
+    int
+    findColumn(ComponentTypeID type) const { return columnIndex[type]; }
+
+    bool
+    hasAll(ComponentMask required) const { return (mask & required) == required; }
+
+    EntityID*
+    entities(const Chunk& chunk) const { return reinterpret_cast<EntityID*>(chunk.data); }
+
+    void*
+    component(const Chunk& chunk, int column, uint32_t row) const {
+        return chunk.data + columnOffsets[column] + columnSizes[column] * row;
+    }
+};
+
+/**
+ * @brief Arquetipos que cumplen una firma de consulta; el World añade los arquetipos nuevos
+ * que la cumplan en cuanto los crea, así que la lista nunca se recalcula entera.
+ */
+struct QueryCache {
+    ComponentMask required = 0; ///< Tipos que deben estar todos.
+    ComponentMask excluded = 0; ///< Tipos que no deben estar.
+    std::vector<Archetype*> archetypes; ///< Arquetipos que cumplen la firma, en orden de creación.
+
+    bool
+    matches(const Archetype& archetype) const {
+        return archetype.hasAll(required) && (archetype.mask & excluded) == 0;
+    }
+};
+
+template <typename... Ts>
+class Query;
+
+class EntityCommandBuffer;
+
+/**
+ * @brief Almacenamiento de componentes por arquetipos (SoA por chunks).
+ *
+ * Las entidades con el mismo conjunto de componentes comparten arquetipo y se guardan en chunks
+ * de 16 KB con un array contiguo por tipo de componente, de modo que un sistema que recorre,
+ * por ejemplo, todos los Transform lee memoria lineal en lugar de saltar por el heap. Añadir o
+ * quitar un componente mueve la entidad a otro arquetipo; los punteros a componentes solo son
+ * válidos hasta el siguiente cambio estructural (crear, destruir, añadir o quitar componentes).
+ */
+class
+World {
+public:
+    /**
+     * @brief Tamaño de cada chunk.
+     */
+    static constexpr size_t ChunkSize = 16 * 1024;
+
+    /**
+     * @brief Alineación de cada columna dentro del chunk: una línea de caché, apta para SIMD.
+     */
+    static constexpr size_t ColumnAlignment = 64;
+
+    World();
+    ~World();
+
+    World(const World&) = delete;
+    World&
+    operator=(const World&) = delete;
+
+    /**
+     * @brief Crea una entidad sin componentes.
+     */
+    EntityID
+    createEntity();
+
+    /**
+     * @brief Destruye la entidad y todos sus componentes.
+     */
+    void
+    destroyEntity(EntityID entity);
+
+    /**
+     * @brief Reserva registros para count entidades más, para crear un lote sin realojar la tabla.
+     */
+    void
+    reserveEntities(size_t count) { m_records.reserve(m_records.size() - m_freeRecords.size() + count); }
+
+    /**
+     * @brief Indica si el identificador corresponde a una entidad viva.
+     */
+    bool
+    isAlive(EntityID entity) const {
+        return entity.index < m_records.size() &&
+               m_records[entity.index].generation == entity.generation &&
+               m_records[entity.index].archetype != nullptr;
+    }
+
+    /**
+     * @brief Construye un componente en la entidad, moviéndola al arquetipo que lo incluye.
+     * @return Puntero al componente; si ya existía se devuelve el existente.
+     */
+    template <typename T, typename... Args>
+    T*
+    addComponent(EntityID entity, Args&&... args) {
+        assert(isAlive(entity));
+        checkAccess<T>("addComponent");
+        ComponentRegistry::ensureRegistered<T>();
+        constexpr ComponentTypeID type = ComponentRegistry::getID<T>();
+        EntityRecord& record = m_records[entity.index];
+        int column = record.archetype->findColumn(type);
+        if (column < 0) {
+            moveEntity(entity, getAddTarget(record.archetype, type), type);
+            column = record.archetype->findColumn(type);
+            void* memory = record.archetype->component(record.archetype->chunks[record.chunk], column, record.row);
+            return ::new (memory) T(std::forward<Args>(args)...);
+        }
+        return static_cast<T*>(record.archetype->component(record.archetype->chunks[record.chunk], column, record.row));
+    }
+
+    /**
+     * @brief Destruye el componente y mueve la entidad al arquetipo sin él.
+     */
+    template <typename T>
+    void
+    removeComponent(EntityID entity) {
+        assert(isAlive(entity));
+        checkAccess<T>("removeComponent");
+        constexpr ComponentTypeID type = ComponentRegistry::getID<T>();
+        EntityRecord& record = m_records[entity.index];
+        if (record.archetype->mask & ComponentRegistry::getMask<T>()) {
+            moveEntity(entity, getRemoveTarget(record.archetype, type), type);
+        }
+    }
+
+    /**
+     * @brief Componente de la entidad, o nullptr si no lo tiene: un test de bit y una carga de la tabla de columnas.
+     * Con T const cuenta como lectura para las comprobaciones de acceso.
+     */
+    template <typename T>
+    T*
+    getComponent(EntityID entity) {
+        checkAccess<T>("getComponent");
+        if (!isAlive(entity)) {
+            return nullptr;
+        }
+        const EntityRecord& record = m_records[entity.index];
+        const Archetype& archetype = *record.archetype;
+        if (!(archetype.mask & ComponentRegistry::getMask<T>())) {
+            return nullptr;
+        }
+        return static_cast<T*>(archetype.component(archetype.chunks[record.chunk],
+                                                   archetype.columnIndex[ComponentRegistry::getID<T>()], record.row));
+    }
+
+    template <typename T>
+    bool
+    hasComponent(EntityID entity) const {
+        return isAlive(entity) && (m_records[entity.index].archetype->mask & ComponentRegistry::getMask<T>()) != 0;
+    }
+
+    /**
+     * @brief Máscara con los tipos de componente de la entidad (0 si no está viva).
+     */
+    ComponentMask
+    getComponentMask(EntityID entity) const {
+        return isAlive(entity) ? m_records[entity.index].archetype->mask : 0;
+    }
+
+    /**
+     * @brief Recorre chunk a chunk las entidades que tienen todos los tipos Ts.
+     * Los tipos const cuentan como lectura para las comprobaciones de acceso.
+     * @param func Se llama como func(count, entities, Ts*...) con los arrays contiguos de cada chunk.
+     */
+    template <typename... Ts, typename Func>
+    void
+    eachChunk(Func&& func) {
+        (checkAccess<Ts>("eachChunk"), ...);
+        constexpr ComponentMask required = (ComponentRegistry::getMask<Ts>() | ...);
+        for (auto& archetypePtr : m_archetypes) {
+            Archetype& archetype = *archetypePtr;
+            if (archetype.entityCount == 0 || !archetype.hasAll(required)) {
+                continue;
+            }
+            const int columns[] = {archetype.columnIndex[ComponentRegistry::getID<Ts>()]...};
+            for (size_t c = 0; c < archetype.chunks.size(); ++c) {
+                // Mientras se procesa este chunk se trae a caché el comienzo del siguiente
+                if (c + 1 < archetype.chunks.size()) {
+                    prefetchChunk(archetype, archetype.chunks[c + 1], columns, sizeof...(Ts));
+                }
+                const Chunk& chunk = archetype.chunks[c];
+                callChunk<Ts...>(func, archetype, chunk, columns, std::index_sequence_for<Ts...>());
+            }
+        }
+    }
+
+    /**
+     * @brief Recorre una a una las entidades que tienen todos los tipos Ts.
+     * @param func Se llama como func(Ts&...) para cada entidad, en orden de memoria.
+     */
+    template <typename... Ts, typename Func>
+    void
+    each(Func&& func) {
+        eachChunk<Ts...>([&func](uint32_t count, const EntityID*, Ts*... arrays) {
+            for (uint32_t i = 0; i < count; ++i) {
+                func(arrays[i]...);
+            }
+        });
+    }
+
+    size_t
+    getEntityCount() const { return m_entityCount; }
+
+    size_t
+    getArchetypeCount() const { return m_archetypes.size(); }
+
+    size_t
+    getChunkCount() const;
+
+    /**
+     * @brief Consulta que recorre las entidades con los tipos Ts (más los filtros que se le añadan).
+     * La lista de arquetipos se resuelve y cachea en el primer uso; conviene crear la consulta
+     * una vez y conservarla.
+     */
+    template <typename... Ts>
+    Query<Ts...>
+    query();
+
+    /**
+     * @brief Jerarquía padre/hijo de los Transform de este mundo.
+     */
+    SceneGraph&
+    getSceneGraph() { return m_sceneGraph; }
+
+    /**
+     * @brief Declara el acceso del sistema que corre en este hilo (nullptr fuera de los sistemas).
+     * Lo usa SystemScheduler; sin sistema activo no se comprueba nada.
+     */
+    static void
+    setCurrentAccess(const SystemAccess* access) { currentAccess() = access; }
+
+private:
+    /**
+     * @brief Ubicación de una entidad: arquetipo, chunk y fila.
+     */
+    struct EntityRecord {
+        Archetype* archetype = nullptr; ///< nullptr si el registro está libre.
+        uint32_t chunk = 0;
+        uint32_t row = 0;
+        uint32_t generation = 0;
+    };
+
+    Archetype*
+    getOrCreateArchetype(ComponentMask mask);
+
+    Archetype*
+    getAddTarget(Archetype* source, ComponentTypeID type);
+
+    Archetype*
+    getRemoveTarget(Archetype* source, ComponentTypeID type);
+
+    /**
+     * @brief Reserva una fila al final del arquetipo, abriendo un chunk nuevo si el último está lleno.
+     */
+    void
+    allocateRow(Archetype& archetype, EntityID entity, uint32_t& chunkIndex, uint32_t& row);
+
+    /**
+     * @brief Quita una fila ya vacía (componentes destruidos o movidos) rellenándola con la última.
+     */
+    void
+    removeRow(Archetype& archetype, uint32_t chunkIndex, uint32_t row);
+
+    /**
+     * @brief Mueve la entidad a target; los componentes comunes se mueven, el tipo que sobra se
+     * destruye y el que falta queda sin construir (changedType).
+     */
+    void
+    moveEntity(EntityID entity, Archetype* target, ComponentTypeID changedType);
+
+    template <typename... Ts>
+    friend class Query;
+    friend class EntityCommandBuffer;
+
+    /**
+     * @brief Versión sin tipo de addComponent para EntityCommandBuffer: deja la entidad en un
+     * arquetipo con el tipo y devuelve la memoria sin construir de su componente (si ya lo tenía,
+     * el anterior se destruye).
+     */
+    void*
+    emplaceComponent(EntityID entity, ComponentTypeID type);
+
+    /**
+     * @brief Versión sin tipo de removeComponent para EntityCommandBuffer.
+     */
+    void
+    eraseComponent(EntityID entity, ComponentTypeID type);
+
+    /**
+     * @brief Caché de la firma indicada; la crea (recorriendo los arquetipos existentes) si no existe.
+     * Crear una caché es un cambio estructural: no debe hacerse mientras otros hilos usan el mundo.
+     */
+    QueryCache*
+    getQueryCache(ComponentMask required, ComponentMask excluded);
+
+    static const SystemAccess*&
+    currentAccess() {
+        static thread_local const SystemAccess* s_access = nullptr;
+        return s_access;
+    }
+
+    /**
+     * @brief Avisa si el sistema activo toca T sin haberlo declarado: un T const necesita
+     * lectura o escritura declarada, un T no const necesita escritura.
+     */
+    template <typename T>
+    static void
+    checkAccess(const char* method) {
+#if ECS_CHECK_ACCESS
+        const SystemAccess* access = currentAccess();
+        if (!access) {
+            return;
+        }
+        constexpr ComponentMask mask = ComponentRegistry::getMask<T>();
+        bool allowed = std::is_const<T>::value ? ((access->reads | access->writes) & mask) != 0
+                                               : (access->writes & mask) != 0;
+        if (!allowed) {
+            ERROR("World", method, "System " << access->system << (std::is_const<T>::value ? " read" : " wrote")
+                  << " undeclared component type " << ComponentRegistry::getID<T>());
+            assert(false && "System accessed a component type it did not declare");
+        }
+#else
+        (void)method;
+#endif
+    }
+
+    static void
+    prefetchChunk(const Archetype& archetype, const Chunk& chunk, const int* columns, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            _mm_prefetch(reinterpret_cast<const char*>(chunk.data + archetype.columnOffsets[columns[i]]), _MM_HINT_T0);
+        }
+    }
+
+    template <typename... Ts, typename Func, size_t... I>
+    static void
+    callChunk(Func& func, const Archetype& archetype, const Chunk& chunk, const int* columns,
+              std::index_sequence<I...>) {
+        func(chunk.count, archetype.entities(chunk),
+             reinterpret_cast<Ts*>(chunk.data + archetype.columnOffsets[columns[I]])...);
+    }
+
+    std::vector<EntityRecord> m_records; ///< Registro por índice de entidad.
+    std::vector<uint32_t> m_freeRecords; ///< Índices de registros libres para reutilizar.
+    std::vector<EU::TUniquePtr<Archetype>> m_archetypes; ///< Arquetipos creados; no se destruyen hasta el final.
+    Archetype* m_emptyArchetype = nullptr; ///< Arquetipo de las entidades sin componentes.
+    EU::TFixedPool m_chunkPool; ///< Chunks de ChunkSize bytes, reutilizados entre arquetipos.
+    size_t m_entityCount = 0; ///< Entidades vivas.
+    SceneGraph m_sceneGraph; ///< Jerarquía de transformaciones.
+    std::vector<EU::TUniquePtr<QueryCache>> m_queries; ///< Cachés de consultas; no se destruyen hasta el final.
+};
+
+/**
+ * @brief Consulta cacheada sobre una firma de componentes.
+ *
+ * Ts son los tipos que se entregan en cada iteración; with<Us...>() exige tipos adicionales
+ * sin entregarlos y without<Us...>() descarta entidades que los tengan, por ejemplo
+ * `world.query<const MeshRenderer>().with<Transform, ShadowCaster>()`. La iteración recorre solo
+ * los arquetipos que cumplen la firma, chunk a chunk, en el mismo orden que eachChunk().
+ */
+template <typename... Ts>
+class
+Query {
+public:
+    Query() = default;
+
+    explicit
+    Query(World& world) :
+        m_world(&world), m_required((ComponentRegistry::getMask<Ts>() | ... | ComponentMask(0))) {
+    }
+
+    /**
+     * @brief Exige además los tipos Us (sin entregarlos en la iteración).
+     */
+    template <typename... Us>
+    Query&
+    with() {
+        m_required |= (ComponentRegistry::getMask<Us>() | ... | ComponentMask(0));
+        m_cache = nullptr;
+        return *this;
+    }
+
+    /**
+     * @brief Descarta las entidades que tengan alguno de los tipos Us.
+     */
+    template <typename... Us>
+    Query&
+    without() {
+        m_excluded |= (ComponentRegistry::getMask<Us>() | ... | ComponentMask(0));
+        m_cache = nullptr;
+        return *this;
+    }
+
+    /**
+     * @brief Recorre chunk a chunk las entidades que cumplen la consulta.
+     * @param func Se llama como func(count, entities, Ts*...) con los arrays contiguos de cada chunk.
+     */
+    template <typename Func>
+    void
+    eachChunk(Func&& func) {
+        (World::checkAccess<Ts>("Query::eachChunk"), ...);
+        for (Archetype* archetype : resolve().archetypes) {
+            if (archetype->entityCount == 0) {
+                continue;
+            }
+            const int columns[] = {archetype->columnIndex[ComponentRegistry::getID<Ts>()]..., 0};
+            for (size_t c = 0; c < archetype->chunks.size(); ++c) {
+                if (c + 1 < archetype->chunks.size()) {
+                    World::prefetchChunk(*archetype, archetype->chunks[c + 1], columns, sizeof...(Ts));
+                }
+                const Chunk& chunk = archetype->chunks[c];
+                World::callChunk<Ts...>(func, *archetype, chunk, columns, std::index_sequence_for<Ts...>());
+            }
+        }
+    }
+
+    /**
+     * @brief Recorre una a una las entidades que cumplen la consulta.
+     * @param func Se llama como func(Ts&...) para cada entidad, en orden de memoria.
+     */
+    template <typename Func>
+    void
+    each(Func&& func) {
+        eachChunk([&func](uint32_t count, const EntityID*, Ts*... arrays) {
+            for (uint32_t i = 0; i < count; ++i) {
+                func(arrays[i]...);
+            }
+        });
+    }
+
+    /**
+     * @brief Número de entidades que cumplen la consulta.
+     */
+    size_t
+    count() {
+        size_t total = 0;
+        for (Archetype* archetype : resolve().archetypes) {
+            total += archetype->entityCount;
+        }
+        return total;
+    }
+
+private:
+    QueryCache&
+    resolve() {
+        if (!m_cache) {
+            m_cache = m_world->getQueryCache(m_required, m_excluded);
+        }
+        return *m_cache;
+    }
+
+    World* m_world = nullptr; ///< Mundo consultado (no propio).
+    ComponentMask m_required = 0; ///< Tipos exigidos.
+    ComponentMask m_excluded = 0; ///< Tipos excluidos.
+    QueryCache* m_cache = nullptr; ///< Caché compartida del mundo, resuelta en el primer uso.
+};
+
+template <typename... Ts>
+Query<Ts...>
+World::query() {
+    return Query<Ts...>(*this);
+}
\ No newline at end of file
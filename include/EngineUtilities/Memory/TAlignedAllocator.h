@@ -0,0 +1,383 @@
+﻿/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <vector>
+#include "TMemoryTracker.h"
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+namespace EU {
+	/**
+	 * @brief Alineación por defecto para datos SIMD: una línea de caché, suficiente para AVX-512.
+	 */
+	constexpr size_t SimdAlignment = 64;
+
+	/**
+	 * @brief Tamaño a partir del cual TLargePageAllocator usa páginas grandes (2 MB en x64).
+	 */
+	constexpr size_t LargePageThreshold = 2 * 1024 * 1024;
+
+	/**
+	 * @brief Reserva memoria alineada sin cabecera ni seguimiento; se libera con AlignedFree().
+	 *
+	 * @param size Bytes a reservar.
+	 * @param alignment Alineación requerida (potencia de dos).
+	 * @return Puntero a la memoria, o nullptr si no hay memoria.
+	 */
+	inline void* AlignedAllocate(size_t size, size_t alignment = SimdAlignment)
+	{
+		if (alignment < sizeof(void*))
+		{
+			alignment = sizeof(void*);
+		}
+#if defined(_WIN32)
+		return _aligned_malloc(size ? size : 1, alignment);
+#else
+		void* result = nullptr;
+		return posix_memalign(&result, alignment, size ? size : 1) == 0 ? result : nullptr;
+#endif
+	}
+
+	/**
+	 * @brief Libera memoria obtenida con AlignedAllocate().
+	 */
+	inline void AlignedFree(void* ptr)
+	{
+#if defined(_WIN32)
+		_aligned_free(ptr);
+#else
+		std::free(ptr);
+#endif
+	}
+
+	/**
+	 * @brief Intenta habilitar el privilegio de páginas grandes del proceso.
+	 *
+	 * En Windows MEM_LARGE_PAGES requiere SeLockMemoryPrivilege, que el usuario debe tener
+	 * concedido en la directiva local; sin él AllocatePages() recurre a páginas normales.
+	 * En Linux no hace falta privilegio: se comprueba que haya páginas de hugetlbfs reservadas
+	 * mapeando y liberando una de prueba. Con false AllocatePages() puede seguir obteniendo
+	 * páginas grandes transparentes (THP), que no se pueden comprobar de antemano.
+	 *
+	 * @return true si AllocatePages() puede obtener páginas grandes explícitas.
+	 */
+	inline bool EnableLargePages()
+	{
+#if defined(_WIN32)
+		HANDLE token;
+		if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token))
+		{
+			return false;
+		}
+		TOKEN_PRIVILEGES privileges = {};
+		privileges.PrivilegeCount = 1;
+		privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+		bool enabled = LookupPrivilegeValue(nullptr, SE_LOCK_MEMORY_NAME, &privileges.Privileges[0].Luid)
+			&& AdjustTokenPrivileges(token, FALSE, &privileges, 0, nullptr, nullptr)
+			&& GetLastError() == ERROR_SUCCESS;
+		CloseHandle(token);
+		return enabled;
+#elif defined(MAP_HUGETLB)
+		void* probe = mmap(nullptr, LargePageThreshold, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+		if (probe == MAP_FAILED)
+		{
+			return false;
+		}
+		munmap(probe, LargePageThreshold);
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	/**
+	 * @brief Tamaño de página grande del sistema, o 0 si no se soportan.
+	 */
+	inline size_t GetLargePageSize()
+	{
+#if defined(_WIN32)
+		return static_cast<size_t>(GetLargePageMinimum());
+#else
+		return LargePageThreshold;
+#endif
+	}
+
+	/**
+	 * @brief Memoria reservada directamente al sistema por páginas.
+	 */
+	struct PageAllocation
+	{
+		void* memory = nullptr;               ///< Inicio de la reserva (alineado a página).
+		size_t bytes = 0;                     ///< Bytes reservados, redondeados a página.
+		bool largePages = false;              ///< true si está respaldada por páginas grandes explícitas.
+		EMemoryTag tag = EMemoryTag::GENERAL; ///< Etiqueta a la que se atribuye.
+	};
+
+	/**
+	 * @brief Reserva memoria por páginas, opcionalmente respaldada por páginas grandes.
+	 *
+	 * Con preferLargePages se intenta primero MEM_LARGE_PAGES (Windows) o MAP_HUGETLB (Linux)
+	 * redondeando al tamaño de página grande; si no hay páginas grandes disponibles se usan
+	 * páginas normales y, en Linux, se pide THP con madvise(MADV_HUGEPAGE).
+	 *
+	 * @param bytes Bytes a reservar.
+	 * @param preferLargePages Intentar respaldar la reserva con páginas grandes.
+	 * @param tag Subsistema al que se atribuye la memoria.
+	 * @return Reserva con memory == nullptr si no hay memoria.
+	 */
+	inline PageAllocation AllocatePages(size_t bytes, bool preferLargePages, EMemoryTag tag = EMemoryTag::GENERAL)
+	{
+		PageAllocation result;
+		result.tag = tag;
+		size_t largePage = GetLargePageSize();
+		if (preferLargePages && largePage)
+		{
+			size_t rounded = (bytes + largePage - 1) & ~(largePage - 1);
+#if defined(_WIN32)
+			void* memory = VirtualAlloc(nullptr, rounded, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+#else
+			void* memory = mmap(nullptr, rounded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+			if (memory == MAP_FAILED)
+			{
+				memory = nullptr;
+			}
+#endif
+			if (memory)
+			{
+				result.memory = memory;
+				result.bytes = rounded;
+				result.largePages = true;
+				TMemoryTracker::get().recordAlloc(tag, rounded);
+				return result;
+			}
+			bytes = rounded;
+		}
+
+#if defined(_WIN32)
+		result.memory = VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+		void* memory = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		result.memory = memory == MAP_FAILED ? nullptr : memory;
+#if defined(MADV_HUGEPAGE)
+		if (result.memory && preferLargePages)
+		{
+			madvise(result.memory, bytes, MADV_HUGEPAGE);
+		}
+#endif
+#endif
+		if (result.memory)
+		{
+			result.bytes = bytes;
+			TMemoryTracker::get().recordAlloc(tag, bytes);
+		}
+		return result;
+	}
+
+	/**
+	 * @brief Devuelve al sistema una reserva de AllocatePages() y la deja vacía.
+	 */
+	inline void FreePages(PageAllocation& allocation)
+	{
+		if (!allocation.memory)
+		{
+			return;
+		}
+		TMemoryTracker::get().recordFree(allocation.tag, allocation.bytes);
+#if defined(_WIN32)
+		VirtualFree(allocation.memory, 0, MEM_RELEASE);
+#else
+		munmap(allocation.memory, allocation.bytes);
+#endif
+		allocation = PageAllocation();
+	}
+
+	/**
+	 * @brief Asignador STL que alinea la memoria de un contenedor para cargas SIMD alineadas.
+	 *
+	 * @tparam Alignment Alineación de la memoria (potencia de dos).
+	 * @tparam Tag Subsistema al que se atribuye la memoria.
+	 */
+	template<typename T, size_t Alignment = SimdAlignment, EMemoryTag Tag = EMemoryTag::GENERAL>
+	class TAlignedAllocator
+	{
+	public:
+		using value_type = T;
+
+		static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+
+		template<typename U>
+		struct rebind
+		{
+			using other = TAlignedAllocator<U, Alignment, Tag>;
+		};
+
+		TAlignedAllocator() = default;
+
+		template<typename U>
+		TAlignedAllocator(const TAlignedAllocator<U, Alignment, Tag>&) {}
+
+		T* allocate(size_t count)
+		{
+			void* result = AlignedAllocate(count * sizeof(T), Alignment < alignof(T) ? alignof(T) : Alignment);
+			if (!result)
+			{
+				throw std::bad_alloc();
+			}
+			TMemoryTracker::get().recordAlloc(Tag, count * sizeof(T));
+			return static_cast<T*>(result);
+		}
+
+		void deallocate(T* ptr, size_t count)
+		{
+			TMemoryTracker::get().recordFree(Tag, count * sizeof(T));
+			AlignedFree(ptr);
+		}
+	};
+
+	template<typename T, typename U, size_t Alignment, EMemoryTag Tag>
+	bool operator==(const TAlignedAllocator<T, Alignment, Tag>&, const TAlignedAllocator<U, Alignment, Tag>&) { return true; }
+
+	template<typename T, typename U, size_t Alignment, EMemoryTag Tag>
+	bool operator!=(const TAlignedAllocator<T, Alignment, Tag>&, const TAlignedAllocator<U, Alignment, Tag>&) { return false; }
+
+	/**
+	 * @brief std::vector con su memoria alineada a Alignment bytes.
+	 */
+	template<typename T, size_t Alignment = SimdAlignment, EMemoryTag Tag = EMemoryTag::GENERAL>
+	using TAlignedVector = std::vector<T, TAlignedAllocator<T, Alignment, Tag>>;
+
+	/**
+	 * @brief Asignador STL para arrays grandes: a partir de LargePageThreshold reserva por
+	 * páginas grandes; por debajo se comporta como TAlignedAllocator.
+	 *
+	 * Pensado para pools de vértices e índices espaciales de varios MB, donde reducir fallos
+	 * de TLB compensa redondear cada reserva a 2 MB.
+	 */
+	template<typename T, EMemoryTag Tag = EMemoryTag::GENERAL>
+	class TLargePageAllocator
+	{
+	public:
+		using value_type = T;
+
+		template<typename U>
+		struct rebind
+		{
+			using other = TLargePageAllocator<U, Tag>;
+		};
+
+		TLargePageAllocator() = default;
+
+		template<typename U>
+		TLargePageAllocator(const TLargePageAllocator<U, Tag>&) {}
+
+		T* allocate(size_t count)
+		{
+			size_t bytes = count * sizeof(T);
+			void* result;
+			if (bytes >= LargePageThreshold)
+			{
+				result = AllocatePages(bytes, true, Tag).memory;
+			}
+			else
+			{
+				result = AlignedAllocate(bytes, SimdAlignment < alignof(T) ? alignof(T) : SimdAlignment);
+				if (result)
+				{
+					TMemoryTracker::get().recordAlloc(Tag, bytes);
+				}
+			}
+			if (!result)
+			{
+				throw std::bad_alloc();
+			}
+			return static_cast<T*>(result);
+		}
+
+		void deallocate(T* ptr, size_t count)
+		{
+			size_t bytes = count * sizeof(T);
+			if (bytes >= LargePageThreshold)
+			{
+				// Se reconstruye la reserva: el redondeo a página grande es determinista
+				size_t largePage = GetLargePageSize();
+				PageAllocation allocation;
+				allocation.memory = ptr;
+				allocation.bytes = largePage ? (bytes + largePage - 1) & ~(largePage - 1) : bytes;
+				allocation.tag = Tag;
+				FreePages(allocation);
+			}
+			else
+			{
+				TMemoryTracker::get().recordFree(Tag, bytes);
+				AlignedFree(ptr);
+			}
+		}
+	};
+
+	template<typename T, typename U, EMemoryTag Tag>
+	bool operator==(const TLargePageAllocator<T, Tag>&, const TLargePageAllocator<U, Tag>&) { return true; }
+
+	template<typename T, typename U, EMemoryTag Tag>
+	bool operator!=(const TLargePageAllocator<T, Tag>&, const TLargePageAllocator<U, Tag>&) { return false; }
+
+	/**
+	 * @brief std::vector para datos masivos respaldado por páginas grandes.
+	 */
+	template<typename T, EMemoryTag Tag = EMemoryTag::GENERAL>
+	using TLargePageVector = std::vector<T, TLargePageAllocator<T, Tag>>;
+
+	// EXAMPLE
+
+	/*
+	int main()
+	{
+		EU::EnableLargePages();                               // Opcional: sin privilegio se usan páginas normales
+
+		EU::TAlignedVector<float, 32> Positions(1024);        // Cargas _mm256_load_ps válidas
+		__m256 First = _mm256_load_ps(Positions.data());
+
+		EU::TLargePageVector<XMFLOAT3, EU::EMemoryTag::MESH> VertexPool;
+		VertexPool.reserve(1000000);                          // 12 MB en páginas de 2 MB
+
+		EU::PageAllocation Region = EU::AllocatePages(256 * 1024 * 1024, true, EU::EMemoryTag::TEXTURE);
+		std::cout << "large pages: " << Region.largePages << " bytes: " << Region.bytes << std::endl;
+		EU::FreePages(Region);
+
+		return 0;
+	}
+	*/
+}
\ No newline at end of file
@@ -0,0 +1,273 @@
+﻿/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include "TAlignedAllocator.h"
+
+/**
+ * @brief Si es 0, EU_DEFINE_ALLOCATION_HOOKS() no reemplaza new/delete y los contadores se quedan a cero.
+ */
+#ifndef EU_ENABLE_ALLOCATION_HOOKS
+#define EU_ENABLE_ALLOCATION_HOOKS 1
+#endif
+
+namespace EU {
+	/**
+	 * @brief Reservas de heap hechas en un intervalo (frame, ámbito o desde el inicio).
+	 */
+	struct AllocationCounts
+	{
+		uint64_t allocations = 0; ///< Llamadas a operator new.
+		uint64_t bytes = 0;       ///< Bytes pedidos a operator new.
+		uint64_t frees = 0;       ///< Llamadas a operator delete con puntero no nulo.
+
+		AllocationCounts operator-(const AllocationCounts& other) const
+		{
+			AllocationCounts result;
+			result.allocations = allocations - other.allocations;
+			result.bytes = bytes - other.bytes;
+			result.frees = frees - other.frees;
+			return result;
+		}
+	};
+
+	/**
+	 * @brief Cuenta las reservas que pasan por el operator new global.
+	 *
+	 * Los contadores los alimentan los operadores que define EU_DEFINE_ALLOCATION_HOOKS(): unos
+	 * globales atómicos para el total del proceso y otros por hilo para medir un ámbito sin que
+	 * interfieran los demás hilos. Sirve para comprobar que el bucle estable del motor no pide
+	 * memoria al heap: los picos de malloc son una fuente típica de tirones en el frame pacing.
+	 */
+	class TAllocationCounter
+	{
+	public:
+		/**
+		 * @brief Instancia global; sus contadores se inicializan en tiempo de compilación,
+		 * así que es válida incluso en reservas anteriores a main().
+		 */
+		static TAllocationCounter& get()
+		{
+			static TAllocationCounter instance;
+			return instance;
+		}
+
+		/**
+		 * @brief Registra una reserva (lo llama operator new).
+		 */
+		static void recordAlloc(size_t size)
+		{
+			TAllocationCounter& counter = get();
+			counter.allocations.fetch_add(1, std::memory_order_relaxed);
+			counter.bytes.fetch_add(size, std::memory_order_relaxed);
+			AllocationCounts& local = threadCounts();
+			++local.allocations;
+			local.bytes += size;
+		}
+
+		/**
+		 * @brief Registra una liberación (lo llama operator delete).
+		 */
+		static void recordFree()
+		{
+			get().frees.fetch_add(1, std::memory_order_relaxed);
+			++threadCounts().frees;
+		}
+
+		/**
+		 * @brief Reservas de todo el proceso desde el arranque.
+		 */
+		AllocationCounts getTotals() const
+		{
+			AllocationCounts result;
+			result.allocations = allocations.load(std::memory_order_relaxed);
+			result.bytes = bytes.load(std::memory_order_relaxed);
+			result.frees = frees.load(std::memory_order_relaxed);
+			return result;
+		}
+
+		/**
+		 * @brief Reservas del hilo que llama desde su creación.
+		 */
+		static AllocationCounts getThreadTotals()
+		{
+			return threadCounts();
+		}
+
+		/**
+		 * @brief Cierra el frame anterior y empieza a contar uno nuevo; se llama una vez por frame.
+		 *
+		 * @return Reservas de todo el proceso durante el frame que termina.
+		 */
+		AllocationCounts beginFrame()
+		{
+			AllocationCounts now = getTotals();
+			lastFrame = now - frameStart;
+			frameStart = now;
+			return lastFrame;
+		}
+
+		/**
+		 * @brief Reservas del último frame completo.
+		 */
+		const AllocationCounts& getLastFrame() const { return lastFrame; }
+
+	private:
+		constexpr TAllocationCounter() = default;
+
+		static AllocationCounts& threadCounts()
+		{
+			static thread_local AllocationCounts counts;
+			return counts;
+		}
+
+		std::atomic<uint64_t> allocations{ 0 }; ///< Reservas del proceso.
+		std::atomic<uint64_t> bytes{ 0 };       ///< Bytes reservados por el proceso.
+		std::atomic<uint64_t> frees{ 0 };       ///< Liberaciones del proceso.
+		AllocationCounts frameStart;            ///< Totales al empezar el frame actual.
+		AllocationCounts lastFrame;             ///< Reservas del último frame completo.
+	};
+
+	/**
+	 * @brief Mide las reservas que hace el hilo actual mientras el ámbito está vivo.
+	 */
+	class TAllocationScope
+	{
+	public:
+		TAllocationScope() : start(TAllocationCounter::getThreadTotals()) {}
+
+		/**
+		 * @brief Reservas del hilo desde que se creó el ámbito.
+		 */
+		AllocationCounts getCounts() const
+		{
+			return TAllocationCounter::getThreadTotals() - start;
+		}
+
+		/**
+		 * @brief true si el hilo no ha pedido memoria al heap dentro del ámbito.
+		 */
+		bool isAllocationFree() const
+		{
+			return getCounts().allocations == 0;
+		}
+
+	private:
+		AllocationCounts start; ///< Totales del hilo al entrar en el ámbito.
+	};
+}
+
+/**
+ * @brief Define los operator new/delete globales que alimentan TAllocationCounter.
+ *
+ * Debe expandirse en un único archivo .cpp del ejecutable (los operadores globales de
+ * reemplazo no pueden ser inline).
+ */
+#if EU_ENABLE_ALLOCATION_HOOKS
+#define EU_DEFINE_ALLOCATION_HOOKS()                                                       \
+void* operator new(size_t size) {                                                          \
+    EU::TAllocationCounter::recordAlloc(size);                                             \
+    void* ptr = std::malloc(size ? size : 1);                                              \
+    if (!ptr) throw std::bad_alloc();                                                      \
+    return ptr;                                                                            \
+}                                                                                          \
+void* operator new[](size_t size) { return operator new(size); }                           \
+void* operator new(size_t size, const std::nothrow_t&) noexcept {                          \
+    EU::TAllocationCounter::recordAlloc(size);                                             \
+    return std::malloc(size ? size : 1);                                                   \
+}                                                                                          \
+void* operator new[](size_t size, const std::nothrow_t& tag) noexcept {                    \
+    return operator new(size, tag);                                                        \
+}                                                                                          \
+void* operator new(size_t size, std::align_val_t alignment) {                              \
+    EU::TAllocationCounter::recordAlloc(size);                                             \
+    void* ptr = EU::AlignedAllocate(size, static_cast<size_t>(alignment));                 \
+    if (!ptr) throw std::bad_alloc();                                                      \
+    return ptr;                                                                            \
+}                                                                                          \
+void* operator new[](size_t size, std::align_val_t alignment) {                            \
+    return operator new(size, alignment);                                                  \
+}                                                                                          \
+void operator delete(void* ptr) noexcept {                                                 \
+    if (ptr) { EU::TAllocationCounter::recordFree(); std::free(ptr); }                     \
+}                                                                                          \
+void operator delete[](void* ptr) noexcept { operator delete(ptr); }                       \
+void operator delete(void* ptr, size_t) noexcept { operator delete(ptr); }                 \
+void operator delete[](void* ptr, size_t) noexcept { operator delete(ptr); }               \
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { operator delete(ptr); }  \
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { operator delete(ptr); }\
+void operator delete(void* ptr, std::align_val_t) noexcept {                               \
+    if (ptr) { EU::TAllocationCounter::recordFree(); EU::AlignedFree(ptr); }               \
+}                                                                                          \
+void operator delete[](void* ptr, std::align_val_t alignment) noexcept {                   \
+    operator delete(ptr, alignment);                                                       \
+}                                                                                          \
+void operator delete(void* ptr, size_t, std::align_val_t alignment) noexcept {             \
+    operator delete(ptr, alignment);                                                       \
+}                                                                                          \
+void operator delete[](void* ptr, size_t, std::align_val_t alignment) noexcept {           \
+    operator delete(ptr, alignment);                                                       \
+}
+#else
+#define EU_DEFINE_ALLOCATION_HOOKS()
+#endif
+
+// EXAMPLE
+
+/*
+EU_DEFINE_ALLOCATION_HOOKS()
+
+int main()
+{
+	EU::TAllocationCounter& Counter = EU::TAllocationCounter::get();
+
+	std::vector<int> Scratch;
+	Scratch.reserve(1024);                                // Se reserva una vez fuera del bucle
+
+	for (int Frame = 0; Frame < 100; ++Frame)
+	{
+		EU::TAllocationScope Scope;
+
+		Scratch.clear();
+		for (int i = 0; i < 1024; ++i)
+			Scratch.push_back(i);
+
+		if (!Scope.isAllocationFree())
+			std::cout << "frame " << Frame << " allocated " << Scope.getCounts().bytes << " bytes" << std::endl;
+
+		EU::AllocationCounts LastFrame = Counter.beginFrame();
+	}
+
+	return 0;
+}
+*/
\ No newline at end of file
@@ -0,0 +1,408 @@
+﻿/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+#include "TMemoryTracker.h"
+
+namespace EU {
+	/**
+	 * @brief Asignador lineal (bump allocator) para memoria de vida corta.
+	 *
+	 * Reservar es avanzar un desplazamiento dentro de un bloque; no hay liberación individual,
+	 * todo se descarta de golpe con reset(). Si el bloque principal se llena, las peticiones
+	 * siguientes se sirven desde bloques de desbordamiento encadenados, y en el siguiente
+	 * reset() el bloque principal crece hasta el pico observado para que el desbordamiento
+	 * no se repita. Los destructores de lo que se construya aquí nunca se llaman, así que
+	 * solo debe usarse para datos triviales o contenedores que acepten ese contrato.
+	 */
+	class TLinearArena
+	{
+	public:
+		TLinearArena() = default;
+
+		/**
+		 * @brief Crea la arena con un bloque principal de la capacidad indicada.
+		 *
+		 * @param capacity Bytes del bloque principal.
+		 * @param inTag Subsistema al que se atribuye la memoria de la arena.
+		 */
+		explicit TLinearArena(size_t capacity, EMemoryTag inTag = EMemoryTag::GENERAL) { init(capacity, inTag); }
+
+		~TLinearArena()
+		{
+			releaseOverflow();
+			releaseBase();
+		}
+
+		TLinearArena(const TLinearArena&) = delete;
+		TLinearArena& operator=(const TLinearArena&) = delete;
+
+		/**
+		 * @brief (Re)inicializa la arena con un bloque principal nuevo; invalida toda la memoria servida.
+		 *
+		 * @param capacity Bytes del bloque principal.
+		 * @param inTag Subsistema al que se atribuye la memoria de la arena.
+		 */
+		void init(size_t capacity, EMemoryTag inTag = EMemoryTag::GENERAL)
+		{
+			releaseOverflow();
+			releaseBase();
+			tag = inTag;
+			allocateBase(capacity);
+			offset = 0;
+			lastAllocation = nullptr;
+			peakBytes = 0;
+		}
+
+		/**
+		 * @brief Reserva memoria sin inicializar.
+		 *
+		 * @param size Bytes a reservar.
+		 * @param alignment Alineación requerida (potencia de dos).
+		 * @return Puntero válido hasta el próximo reset().
+		 */
+		void* allocate(size_t size, size_t alignment = alignof(std::max_align_t))
+		{
+			uintptr_t current = reinterpret_cast<uintptr_t>(base) + offset;
+			uintptr_t aligned = (current + (alignment - 1)) & ~(uintptr_t)(alignment - 1);
+			size_t newOffset = offset + (aligned - current) + size;
+
+			if (base && newOffset <= capacityBytes)
+			{
+				offset = newOffset;
+				lastAllocation = reinterpret_cast<unsigned char*>(aligned);
+				trackPeak();
+				return lastAllocation;
+			}
+			return allocateOverflow(size, alignment);
+		}
+
+		/**
+		 * @brief Reserva espacio sin inicializar para count elementos de tipo T.
+		 */
+		template<typename T>
+		T* allocateArray(size_t count)
+		{
+			return static_cast<T*>(allocate(count * sizeof(T), alignof(T)));
+		}
+
+		/**
+		 * @brief Devuelve memoria a la arena si es la última reserva del bloque principal.
+		 *
+		 * Permite que un contenedor que crece y suelta su búfer anterior recupere ese hueco
+		 * cuando nadie ha reservado después; en cualquier otro caso no hace nada.
+		 *
+		 * @param ptr Puntero devuelto por allocate().
+		 * @param size Tamaño con el que se reservó.
+		 */
+		void deallocate(void* ptr, size_t size)
+		{
+			unsigned char* bytes = static_cast<unsigned char*>(ptr);
+			if (bytes && bytes == lastAllocation && bytes + size == base + offset)
+			{
+				offset = static_cast<size_t>(bytes - base);
+				lastAllocation = nullptr;
+			}
+		}
+
+		/**
+		 * @brief Descarta todas las reservas. Si hubo desbordamiento, agranda el bloque principal.
+		 */
+		void reset()
+		{
+			if (overflow)
+			{
+				releaseOverflow();
+				size_t grown = capacityBytes;
+				while (grown < peakBytes)
+				{
+					grown = grown ? grown * 2 : peakBytes;
+				}
+				releaseBase();
+				allocateBase(grown);
+			}
+			offset = 0;
+			lastAllocation = nullptr;
+			overflowBytes = 0;
+		}
+
+		/**
+		 * @brief Bytes servidos desde el último reset(), incluidos los de desbordamiento.
+		 */
+		size_t getUsed() const { return offset + overflowBytes; }
+
+		/**
+		 * @brief Capacidad del bloque principal.
+		 */
+		size_t getCapacity() const { return capacityBytes; }
+
+		/**
+		 * @brief Máximo de bytes usados entre dos reset() desde que se creó la arena.
+		 */
+		size_t getPeak() const { return peakBytes; }
+
+		/**
+		 * @brief Indica si el frame actual tuvo que recurrir a bloques de desbordamiento.
+		 */
+		bool hasOverflowed() const { return overflow != nullptr; }
+
+	private:
+		/**
+		 * @brief Cabecera de un bloque de desbordamiento; los datos van justo detrás.
+		 */
+		struct OverflowBlock
+		{
+			OverflowBlock* next;
+			size_t size; ///< Bytes reservados para el bloque, cabecera incluida.
+		};
+
+		void allocateBase(size_t capacity)
+		{
+			base = capacity ? static_cast<unsigned char*>(std::malloc(capacity)) : nullptr;
+			if (capacity && !base)
+			{
+				throw std::bad_alloc();
+			}
+			capacityBytes = capacity;
+			if (base)
+			{
+				TMemoryTracker::get().recordAlloc(tag, capacityBytes);
+			}
+		}
+
+		void releaseBase()
+		{
+			if (base)
+			{
+				TMemoryTracker::get().recordFree(tag, capacityBytes);
+				std::free(base);
+				base = nullptr;
+			}
+			capacityBytes = 0;
+		}
+
+		void* allocateOverflow(size_t size, size_t alignment)
+		{
+			// Se reserva holgura para alinear los datos detrás de la cabecera a cualquier potencia de dos
+			size_t blockSize = sizeof(OverflowBlock) + alignment + size;
+			void* memory = std::malloc(blockSize);
+			if (!memory)
+			{
+				throw std::bad_alloc();
+			}
+			TMemoryTracker::get().recordAlloc(tag, blockSize);
+			OverflowBlock* block = static_cast<OverflowBlock*>(memory);
+			block->next = overflow;
+			block->size = blockSize;
+			overflow = block;
+			overflowBytes += size;
+			trackPeak();
+
+			uintptr_t data = reinterpret_cast<uintptr_t>(memory) + sizeof(OverflowBlock);
+			data = (data + (alignment - 1)) & ~(uintptr_t)(alignment - 1);
+			return reinterpret_cast<void*>(data);
+		}
+
+		void releaseOverflow()
+		{
+			while (overflow)
+			{
+				OverflowBlock* next = overflow->next;
+				TMemoryTracker::get().recordFree(tag, overflow->size);
+				std::free(overflow);
+				overflow = next;
+			}
+		}
+
+		void trackPeak()
+		{
+			size_t used = offset + overflowBytes;
+			if (used > peakBytes)
+			{
+				peakBytes = used;
+			}
+		}
+
+		EMemoryTag tag = EMemoryTag::GENERAL;    ///< Etiqueta de memoria de la arena.
+		unsigned char* base = nullptr;           ///< Bloque principal.
+		size_t capacityBytes = 0;                ///< Tamaño del bloque principal.
+		size_t offset = 0;                       ///< Bytes consumidos del bloque principal.
+		unsigned char* lastAllocation = nullptr; ///< Última reserva del bloque principal (para deallocate).
+		OverflowBlock* overflow = nullptr;       ///< Bloques extra del frame actual.
+		size_t overflowBytes = 0;                ///< Bytes servidos desde bloques extra.
+		size_t peakBytes = 0;                    ///< Pico de uso entre resets.
+	};
+
+	/**
+	 * @brief Arenas por frame con varios frames en vuelo.
+	 *
+	 * Cada frame usa una arena distinta; beginFrame() avanza a la siguiente y la reinicia, así
+	 * que lo reservado en el frame N sigue siendo válido mientras se renderiza ese frame y
+	 * hasta que empieza el frame N + FramesInFlight.
+	 *
+	 * @tparam FramesInFlight Número de arenas que rotan (2 = doble búfer).
+	 */
+	template<size_t FramesInFlight = 2>
+	class TFrameArena
+	{
+		static_assert(FramesInFlight > 0, "TFrameArena needs at least one frame");
+
+	public:
+		/**
+		 * @brief Reserva el bloque principal de cada arena.
+		 *
+		 * @param capacityPerFrame Bytes por arena.
+		 * @param tag Subsistema al que se atribuye la memoria de las arenas.
+		 */
+		void init(size_t capacityPerFrame, EMemoryTag tag = EMemoryTag::GENERAL)
+		{
+			for (TLinearArena& arena : arenas)
+			{
+				arena.init(capacityPerFrame, tag);
+			}
+			frameIndex = 0;
+		}
+
+		/**
+		 * @brief Pasa a la arena del siguiente frame y descarta lo que contenía.
+		 */
+		void beginFrame()
+		{
+			frameIndex = (frameIndex + 1) % FramesInFlight;
+			arenas[frameIndex].reset();
+		}
+
+		/**
+		 * @brief Arena del frame en curso.
+		 */
+		TLinearArena& current() { return arenas[frameIndex]; }
+		const TLinearArena& current() const { return arenas[frameIndex]; }
+
+		/**
+		 * @brief Índice de la arena en uso, en [0, FramesInFlight).
+		 */
+		size_t getFrameIndex() const { return frameIndex; }
+
+	private:
+		TLinearArena arenas[FramesInFlight]; ///< Una arena por frame en vuelo.
+		size_t frameIndex = 0;               ///< Arena activa.
+	};
+
+	/**
+	 * @brief Adaptador de asignador STL sobre una TLinearArena (u otra arena con la misma interfaz).
+	 *
+	 * deallocate() solo recupera memoria si es la última reserva; el resto se libera con el
+	 * reset de la arena. El contenedor no debe sobrevivir a ese reset.
+	 *
+	 * @tparam T Tipo de los elementos.
+	 * @tparam TArena Arena con allocateArray<T>(count) y deallocate(ptr, bytes).
+	 */
+	template<typename T, typename TArena = TLinearArena>
+	class TArenaAllocator
+	{
+	public:
+		using value_type = T;
+
+		explicit TArenaAllocator(TArena& arena) : arena(&arena) {}
+
+		template<typename U>
+		TArenaAllocator(const TArenaAllocator<U, TArena>& other) : arena(other.getArena()) {}
+
+		T* allocate(size_t count)
+		{
+			// Los contenedores STL esperan una excepción, no un puntero nulo, si la arena se agota
+			T* ptr = arena->template allocateArray<T>(count);
+			if (!ptr && count)
+			{
+				throw std::bad_alloc();
+			}
+			return ptr;
+		}
+
+		void deallocate(T* ptr, size_t count)
+		{
+			arena->deallocate(ptr, count * sizeof(T));
+		}
+
+		TArena* getArena() const { return arena; }
+
+	private:
+		TArena* arena; ///< Arena de la que se sirve la memoria.
+	};
+
+	template<typename T, typename U, typename TArena>
+	bool operator==(const TArenaAllocator<T, TArena>& a, const TArenaAllocator<U, TArena>& b) { return a.getArena() == b.getArena(); }
+
+	template<typename T, typename U, typename TArena>
+	bool operator!=(const TArenaAllocator<T, TArena>& a, const TArenaAllocator<U, TArena>& b) { return a.getArena() != b.getArena(); }
+
+	/**
+	 * @brief std::vector cuya memoria vive en una arena.
+	 */
+	template<typename T>
+	using TArenaVector = std::vector<T, TArenaAllocator<T>>;
+
+	/**
+	 * @brief std::string cuya memoria vive en una arena.
+	 */
+	using TArenaString = std::basic_string<char, std::char_traits<char>, TArenaAllocator<char>>;
+
+	// EXAMPLE
+
+	/*
+	int main()
+	{
+		EU::TFrameArena<2> FrameArena;
+		FrameArena.init(64 * 1024);
+
+		for (int Frame = 0; Frame < 3; ++Frame)
+		{
+			FrameArena.beginFrame();                       // Descarta lo reservado hace dos frames
+
+			EU::TLinearArena& Arena = FrameArena.current();
+			EU::TArenaVector<int> Visible{ EU::TArenaAllocator<int>(Arena) };
+			Visible.reserve(128);
+			for (int i = 0; i < 128; ++i)
+				Visible.push_back(i);
+
+			EU::TArenaString Label("Frame ", EU::TArenaAllocator<char>(Arena));
+			Label += std::to_string(Frame);
+
+			std::cout << Label << ": " << Arena.getUsed() << " bytes" << std::endl;
+		}
+
+		return 0;
+	}
+	*/
+}
\ No newline at end of file
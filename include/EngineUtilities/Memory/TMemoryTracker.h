@@ -0,0 +1,400 @@
+﻿/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+/**
+ * @brief Pon a 0 para compilar el registro de memoria como operaciones vacías.
+ */
+#ifndef EU_ENABLE_MEMORY_TRACKING
+#define EU_ENABLE_MEMORY_TRACKING 1
+#endif
+
+namespace EU {
+	/**
+	 * @brief Subsistema al que se atribuye una reserva de memoria.
+	 */
+	enum class EMemoryTag : uint8_t
+	{
+		GENERAL,
+		MESH,
+		TEXTURE,
+		RENDER,
+		ECS,
+		UI,
+		LOADER,
+		COUNT
+	};
+
+	/**
+	 * @brief Nombre legible de una etiqueta, para logs y la interfaz.
+	 */
+	inline const char* GetMemoryTagName(EMemoryTag tag)
+	{
+		switch (tag)
+		{
+		case EMemoryTag::GENERAL: return "General";
+		case EMemoryTag::MESH:    return "Mesh";
+		case EMemoryTag::TEXTURE: return "Texture";
+		case EMemoryTag::RENDER:  return "Render";
+		case EMemoryTag::ECS:     return "ECS";
+		case EMemoryTag::UI:      return "UI";
+		case EMemoryTag::LOADER:  return "Loader";
+		default:                  return "Unknown";
+		}
+	}
+
+	/**
+	 * @brief Instantánea de las estadísticas de una etiqueta.
+	 */
+	struct MemoryTagStats
+	{
+		size_t currentBytes = 0; ///< Bytes vivos.
+		size_t peakBytes = 0;    ///< Máximo de bytes vivos desde el inicio (o desde resetPeaks()).
+		size_t liveCount = 0;    ///< Reservas vivas.
+		size_t totalCount = 0;   ///< Reservas hechas desde el inicio.
+		size_t budgetBytes = 0;  ///< Presupuesto (0 = sin límite).
+	};
+
+	/**
+	 * @brief Registro global de memoria por subsistema.
+	 *
+	 * Cada etiqueta lleva bytes actuales, pico y número de reservas en contadores atómicos
+	 * relajados, cada una en su propia línea de caché, así que registrar una reserva cuesta
+	 * un par de sumas atómicas. Los asignadores del motor (pools, arenas, buffers de GPU)
+	 * informan aquí; el tracker no reserva nada por sí mismo.
+	 *
+	 * Si una reserva hace que una etiqueta supere su presupuesto, se llama al callback de
+	 * presupuesto una vez por cruce (vuelve a avisar si baja y lo supera de nuevo).
+	 */
+	class TMemoryTracker
+	{
+	public:
+		/**
+		 * @brief Función llamada al superar un presupuesto; puede llamarse desde cualquier hilo.
+		 */
+		using BudgetCallback = void (*)(EMemoryTag tag, size_t currentBytes, size_t budgetBytes);
+
+		/**
+		 * @brief Instancia global. Se inicializa en compilación, así que es segura en cualquier momento.
+		 */
+		static TMemoryTracker& get()
+		{
+			static TMemoryTracker instance;
+			return instance;
+		}
+
+		/**
+		 * @brief Registra una reserva.
+		 */
+		void recordAlloc(EMemoryTag tag, size_t bytes)
+		{
+#if EU_ENABLE_MEMORY_TRACKING
+			TagCounters& counters = tags[static_cast<size_t>(tag)];
+			size_t previous = counters.current.fetch_add(bytes, std::memory_order_relaxed);
+			size_t now = previous + bytes;
+			counters.live.fetch_add(1, std::memory_order_relaxed);
+			counters.total.fetch_add(1, std::memory_order_relaxed);
+
+			size_t peak = counters.peak.load(std::memory_order_relaxed);
+			while (now > peak && !counters.peak.compare_exchange_weak(peak, now, std::memory_order_relaxed))
+			{
+			}
+
+			size_t budget = counters.budget.load(std::memory_order_relaxed);
+			if (budget != 0 && previous <= budget && now > budget)
+			{
+				BudgetCallback callback = budgetCallback.load(std::memory_order_acquire);
+				if (callback)
+				{
+					callback(tag, now, budget);
+				}
+			}
+#else
+			(void)tag;
+			(void)bytes;
+#endif
+		}
+
+		/**
+		 * @brief Registra una liberación; bytes debe coincidir con lo registrado en recordAlloc().
+		 */
+		void recordFree(EMemoryTag tag, size_t bytes)
+		{
+#if EU_ENABLE_MEMORY_TRACKING
+			TagCounters& counters = tags[static_cast<size_t>(tag)];
+			counters.current.fetch_sub(bytes, std::memory_order_relaxed);
+			counters.live.fetch_sub(1, std::memory_order_relaxed);
+#else
+			(void)tag;
+			(void)bytes;
+#endif
+		}
+
+		/**
+		 * @brief Fija el presupuesto de una etiqueta en bytes (0 lo desactiva).
+		 */
+		void setBudget(EMemoryTag tag, size_t bytes)
+		{
+			tags[static_cast<size_t>(tag)].budget.store(bytes, std::memory_order_relaxed);
+		}
+
+		/**
+		 * @brief Cambia la función que se llama al superar un presupuesto.
+		 */
+		void setBudgetCallback(BudgetCallback callback)
+		{
+			budgetCallback.store(callback, std::memory_order_release);
+		}
+
+		/**
+		 * @brief Estadísticas actuales de una etiqueta.
+		 */
+		MemoryTagStats getStats(EMemoryTag tag) const
+		{
+			const TagCounters& counters = tags[static_cast<size_t>(tag)];
+			MemoryTagStats stats;
+			stats.currentBytes = counters.current.load(std::memory_order_relaxed);
+			stats.peakBytes = counters.peak.load(std::memory_order_relaxed);
+			stats.liveCount = counters.live.load(std::memory_order_relaxed);
+			stats.totalCount = counters.total.load(std::memory_order_relaxed);
+			stats.budgetBytes = counters.budget.load(std::memory_order_relaxed);
+			return stats;
+		}
+
+		/**
+		 * @brief Indica si una etiqueta está por encima de su presupuesto.
+		 */
+		bool isOverBudget(EMemoryTag tag) const
+		{
+			const TagCounters& counters = tags[static_cast<size_t>(tag)];
+			size_t budget = counters.budget.load(std::memory_order_relaxed);
+			return budget != 0 && counters.current.load(std::memory_order_relaxed) > budget;
+		}
+
+		/**
+		 * @brief Suma de bytes vivos de todas las etiquetas.
+		 */
+		size_t getTotalBytes() const
+		{
+			size_t total = 0;
+			for (const TagCounters& counters : tags)
+			{
+				total += counters.current.load(std::memory_order_relaxed);
+			}
+			return total;
+		}
+
+		/**
+		 * @brief Iguala el pico de cada etiqueta a su valor actual.
+		 */
+		void resetPeaks()
+		{
+			for (TagCounters& counters : tags)
+			{
+				counters.peak.store(counters.current.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			}
+		}
+
+	private:
+		/**
+		 * @brief Contadores de una etiqueta, alineados a línea de caché para evitar falso compartir.
+		 */
+		struct alignas(64) TagCounters
+		{
+			std::atomic<size_t> current{ 0 };
+			std::atomic<size_t> peak{ 0 };
+			std::atomic<size_t> live{ 0 };
+			std::atomic<size_t> total{ 0 };
+			std::atomic<size_t> budget{ 0 };
+		};
+
+		TagCounters tags[static_cast<size_t>(EMemoryTag::COUNT)];     ///< Contadores por etiqueta.
+		std::atomic<BudgetCallback> budgetCallback{ nullptr };          ///< Aviso de presupuesto superado.
+	};
+
+	namespace Detail {
+		/**
+		 * @brief Cabecera que precede a cada bloque de TrackedAllocate().
+		 */
+		struct TrackedHeader
+		{
+			size_t size;     ///< Bytes pedidos por el usuario.
+			uint32_t offset; ///< Distancia desde el inicio de la reserva real.
+			EMemoryTag tag;  ///< Etiqueta a la que se atribuye.
+		};
+	}
+
+	/**
+	 * @brief Reserva memoria atribuida a una etiqueta; se libera con TrackedFree().
+	 *
+	 * @param tag Subsistema al que se atribuye la reserva.
+	 * @param size Bytes a reservar.
+	 * @param alignment Alineación requerida (potencia de dos).
+	 * @return Puntero a la memoria, o nullptr si no hay memoria.
+	 */
+	inline void* TrackedAllocate(EMemoryTag tag, size_t size, size_t alignment = alignof(std::max_align_t))
+	{
+		using Detail::TrackedHeader;
+		if (alignment < alignof(TrackedHeader))
+		{
+			alignment = alignof(TrackedHeader);
+		}
+		unsigned char* raw = static_cast<unsigned char*>(std::malloc(size + sizeof(TrackedHeader) + alignment - 1));
+		if (!raw)
+		{
+			return nullptr;
+		}
+		uintptr_t user = reinterpret_cast<uintptr_t>(raw) + sizeof(TrackedHeader);
+		user = (user + (alignment - 1)) & ~(uintptr_t)(alignment - 1);
+
+		TrackedHeader* header = reinterpret_cast<TrackedHeader*>(user) - 1;
+		header->size = size;
+		header->offset = static_cast<uint32_t>(user - reinterpret_cast<uintptr_t>(raw));
+		header->tag = tag;
+		TMemoryTracker::get().recordAlloc(tag, size);
+		return reinterpret_cast<void*>(user);
+	}
+
+	/**
+	 * @brief Libera memoria obtenida con TrackedAllocate() o TrackedReallocate().
+	 */
+	inline void TrackedFree(void* ptr)
+	{
+		if (!ptr)
+		{
+			return;
+		}
+		Detail::TrackedHeader* header = static_cast<Detail::TrackedHeader*>(ptr) - 1;
+		TMemoryTracker::get().recordFree(header->tag, header->size);
+		std::free(static_cast<unsigned char*>(ptr) - header->offset);
+	}
+
+	/**
+	 * @brief Cambia el tamaño de un bloque con la semántica de realloc, conservando su etiqueta.
+	 *
+	 * @param ptr Bloque actual (nullptr equivale a TrackedAllocate).
+	 * @param size Nuevo tamaño (0 libera el bloque y devuelve nullptr).
+	 * @param tag Etiqueta usada si ptr es nullptr.
+	 */
+	inline void* TrackedReallocate(void* ptr, size_t size, EMemoryTag tag = EMemoryTag::GENERAL)
+	{
+		if (!ptr)
+		{
+			return TrackedAllocate(tag, size);
+		}
+		if (size == 0)
+		{
+			TrackedFree(ptr);
+			return nullptr;
+		}
+		Detail::TrackedHeader* header = static_cast<Detail::TrackedHeader*>(ptr) - 1;
+		void* result = TrackedAllocate(header->tag, size);
+		if (result)
+		{
+			std::memcpy(result, ptr, header->size < size ? header->size : size);
+			TrackedFree(ptr);
+		}
+		return result;
+	}
+
+	/**
+	 * @brief Asignador STL que atribuye la memoria de un contenedor a una etiqueta.
+	 *
+	 * No guarda cabecera: el contenedor ya indica el tamaño al liberar.
+	 */
+	template<typename T, EMemoryTag Tag>
+	class TTrackedAllocator
+	{
+	public:
+		using value_type = T;
+
+		template<typename U>
+		struct rebind
+		{
+			using other = TTrackedAllocator<U, Tag>;
+		};
+
+		TTrackedAllocator() = default;
+
+		template<typename U>
+		TTrackedAllocator(const TTrackedAllocator<U, Tag>&) {}
+
+		T* allocate(size_t count)
+		{
+			T* result = static_cast<T*>(::operator new(count * sizeof(T)));
+			TMemoryTracker::get().recordAlloc(Tag, count * sizeof(T));
+			return result;
+		}
+
+		void deallocate(T* ptr, size_t count)
+		{
+			TMemoryTracker::get().recordFree(Tag, count * sizeof(T));
+			::operator delete(ptr);
+		}
+	};
+
+	template<typename T, typename U, EMemoryTag Tag>
+	bool operator==(const TTrackedAllocator<T, Tag>&, const TTrackedAllocator<U, Tag>&) { return true; }
+
+	template<typename T, typename U, EMemoryTag Tag>
+	bool operator!=(const TTrackedAllocator<T, Tag>&, const TTrackedAllocator<U, Tag>&) { return false; }
+
+	// EXAMPLE
+
+	/*
+	void OnBudget(EU::EMemoryTag Tag, size_t Current, size_t Budget)
+	{
+		std::cout << EU::GetMemoryTagName(Tag) << " over budget: " << Current << " / " << Budget << std::endl;
+	}
+
+	int main()
+	{
+		EU::TMemoryTracker& Tracker = EU::TMemoryTracker::get();
+		Tracker.setBudget(EU::EMemoryTag::MESH, 1024);
+		Tracker.setBudgetCallback(&OnBudget);
+
+		std::vector<float, EU::TTrackedAllocator<float, EU::EMemoryTag::MESH>> Vertices;
+		Vertices.resize(512);                                 // 2048 bytes: avisa una vez
+
+		void* Scratch = EU::TrackedAllocate(EU::EMemoryTag::LOADER, 4096, 64);
+		EU::TrackedFree(Scratch);
+
+		EU::MemoryTagStats Stats = Tracker.getStats(EU::EMemoryTag::MESH);
+		std::cout << Stats.currentBytes << " / peak " << Stats.peakBytes << std::endl;
+
+		return 0;
+	}
+	*/
+}
\ No newline at end of file
@@ -0,0 +1,444 @@
+﻿/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+#include "TMemoryTracker.h"
+
+namespace EU {
+	/**
+	 * @brief Pool de bloques de tamaño fijo con crecimiento por páginas.
+	 *
+	 * Los bloques libres forman una lista enlazada dentro de la propia memoria libre, así que
+	 * reservar y liberar son O(1) y no fragmentan el heap. Cuando la lista se vacía se reserva
+	 * una página entera de bloques contiguos. Las páginas no se devuelven al sistema hasta que
+	 * se destruye el pool: un pico de objetos deja memoria lista para reutilizar.
+	 *
+	 * La lista global está protegida por un mutex; cada hilo trabaja contra su ThreadCache y
+	 * solo toca la lista global para mover lotes de bloques, de modo que el caso normal no
+	 * necesita sincronización. Cada página se registra en TMemoryTracker con la etiqueta del pool.
+	 */
+	class TFixedPool
+	{
+	public:
+		/**
+		 * @brief Nodo de la lista libre, superpuesto a un bloque sin usar.
+		 */
+		struct FreeNode
+		{
+			FreeNode* next;
+		};
+
+		/**
+		 * @brief Bloques reservados por página como mínimo.
+		 */
+		static constexpr size_t MinSlotsPerPage = 8;
+
+		/**
+		 * @brief Tamaño de página objetivo en bytes.
+		 */
+		static constexpr size_t PageBytes = 64 * 1024;
+
+		/**
+		 * @brief Bloques que se mueven a la vez entre la caché de un hilo y la lista global.
+		 */
+		static constexpr size_t BatchSize = 32;
+
+		/**
+		 * @brief Crea un pool vacío; la primera página se reserva en la primera petición.
+		 *
+		 * @param inSlotSize Tamaño de cada bloque en bytes.
+		 * @param inSlotAlign Alineación de cada bloque (potencia de dos).
+		 * @param inTag Subsistema al que se atribuyen las páginas.
+		 */
+		TFixedPool(size_t inSlotSize, size_t inSlotAlign, EMemoryTag inTag = EMemoryTag::GENERAL)
+			: tag(inTag)
+		{
+			slotAlign = inSlotAlign < alignof(FreeNode) ? alignof(FreeNode) : inSlotAlign;
+			size_t size = inSlotSize < sizeof(FreeNode) ? sizeof(FreeNode) : inSlotSize;
+			slotSize = (size + slotAlign - 1) & ~(slotAlign - 1);
+			slotsPerPage = PageBytes / slotSize;
+			if (slotsPerPage < MinSlotsPerPage)
+			{
+				slotsPerPage = MinSlotsPerPage;
+			}
+		}
+
+		~TFixedPool()
+		{
+			for (void* page : pages)
+			{
+				TMemoryTracker::get().recordFree(tag, slotSize * slotsPerPage);
+				::operator delete(page, std::align_val_t(slotAlign));
+			}
+		}
+
+		TFixedPool(const TFixedPool&) = delete;
+		TFixedPool& operator=(const TFixedPool&) = delete;
+
+		/**
+		 * @brief Reserva un bloque directamente de la lista global (con bloqueo).
+		 */
+		void* allocate()
+		{
+			FreeNode* node = nullptr;
+			acquireBatch(1, node);
+			return node;
+		}
+
+		/**
+		 * @brief Devuelve un bloque directamente a la lista global (con bloqueo).
+		 */
+		void deallocate(void* ptr)
+		{
+			FreeNode* node = static_cast<FreeNode*>(ptr);
+			node->next = nullptr;
+			releaseBatch(node, node, 1);
+		}
+
+		/**
+		 * @brief Saca hasta count bloques de la lista global, reservando una página si está vacía.
+		 *
+		 * @param count Número de bloques deseado.
+		 * @param outHead Recibe la cabeza de la lista de bloques obtenidos.
+		 * @return Bloques obtenidos (siempre al menos uno).
+		 */
+		size_t acquireBatch(size_t count, FreeNode*& outHead)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			if (!freeList)
+			{
+				allocatePage();
+			}
+
+			FreeNode* head = freeList;
+			FreeNode* tail = head;
+			size_t taken = 1;
+			while (taken < count && tail->next)
+			{
+				tail = tail->next;
+				++taken;
+			}
+			freeList = tail->next;
+			tail->next = nullptr;
+			liveSlots += taken;
+			outHead = head;
+			return taken;
+		}
+
+		/**
+		 * @brief Devuelve a la lista global una cadena ya enlazada de bloques.
+		 */
+		void releaseBatch(FreeNode* head, FreeNode* tail, size_t count)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			tail->next = freeList;
+			freeList = head;
+			liveSlots -= count;
+		}
+
+		/**
+		 * @brief Tamaño real de cada bloque (tras redondear a la alineación).
+		 */
+		size_t getSlotSize() const { return slotSize; }
+
+		/**
+		 * @brief Número de páginas reservadas.
+		 */
+		size_t getPageCount() const
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			return pages.size();
+		}
+
+		/**
+		 * @brief Bloques fuera de la lista global (en uso o en cachés de hilo).
+		 */
+		size_t getLiveSlots() const
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			return liveSlots;
+		}
+
+		/**
+		 * @brief Caché de bloques libres de un hilo para un pool.
+		 *
+		 * Sirve y recibe bloques sin bloqueo; pide o devuelve lotes de BatchSize cuando se vacía
+		 * o acumula demasiados. Al terminar el hilo devuelve al pool todo lo que tenga.
+		 */
+		class ThreadCache
+		{
+		public:
+			/**
+			 * @param inPool Pool al que pertenecen los bloques.
+			 * @param inDestroyed Indicador (trivialmente destructible) que se pone a true al
+			 * destruir la caché, para que el hilo pase a usar el pool directamente.
+			 */
+			explicit ThreadCache(TFixedPool& inPool, bool* inDestroyed = nullptr)
+				: pool(inPool), destroyed(inDestroyed) {}
+
+			~ThreadCache()
+			{
+				if (head)
+				{
+					FreeNode* tail = head;
+					while (tail->next)
+					{
+						tail = tail->next;
+					}
+					pool.releaseBatch(head, tail, count);
+				}
+				head = nullptr;
+				count = 0;
+				if (destroyed)
+				{
+					*destroyed = true;
+				}
+			}
+
+			ThreadCache(const ThreadCache&) = delete;
+			ThreadCache& operator=(const ThreadCache&) = delete;
+
+			void* allocate()
+			{
+				if (!head)
+				{
+					count = pool.acquireBatch(BatchSize, head);
+				}
+				FreeNode* node = head;
+				head = node->next;
+				--count;
+				return node;
+			}
+
+			void deallocate(void* ptr)
+			{
+				FreeNode* node = static_cast<FreeNode*>(ptr);
+				node->next = head;
+				head = node;
+				if (++count >= BatchSize * 2)
+				{
+					// Devuelve el lote más antiguo y conserva los bloques recién liberados (calientes en caché)
+					FreeNode* keepTail = head;
+					for (size_t i = 1; i < BatchSize; ++i)
+					{
+						keepTail = keepTail->next;
+					}
+					FreeNode* giveHead = keepTail->next;
+					FreeNode* giveTail = giveHead;
+					while (giveTail->next)
+					{
+						giveTail = giveTail->next;
+					}
+					keepTail->next = nullptr;
+					pool.releaseBatch(giveHead, giveTail, count - BatchSize);
+					count = BatchSize;
+				}
+			}
+
+		private:
+			TFixedPool& pool;         ///< Pool al que pertenecen los bloques.
+			bool* destroyed;          ///< Se marca al destruir la caché (puede ser nullptr).
+			FreeNode* head = nullptr; ///< Bloques libres locales.
+			size_t count = 0;         ///< Longitud de la lista local.
+		};
+
+	private:
+		void allocatePage()
+		{
+			unsigned char* page = static_cast<unsigned char*>(
+				::operator new(slotSize * slotsPerPage, std::align_val_t(slotAlign)));
+			pages.push_back(page);
+			TMemoryTracker::get().recordAlloc(tag, slotSize * slotsPerPage);
+
+			// Se enlaza en orden de dirección para que reservas consecutivas queden contiguas
+			for (size_t i = 0; i < slotsPerPage; ++i)
+			{
+				FreeNode* node = reinterpret_cast<FreeNode*>(page + i * slotSize);
+				node->next = (i + 1 < slotsPerPage) ? reinterpret_cast<FreeNode*>(page + (i + 1) * slotSize) : freeList;
+			}
+			freeList = reinterpret_cast<FreeNode*>(page);
+		}
+
+		EMemoryTag tag;               ///< Etiqueta de memoria de las páginas.
+		size_t slotSize = 0;          ///< Bytes por bloque.
+		size_t slotAlign = 0;         ///< Alineación de cada bloque y de las páginas.
+		size_t slotsPerPage = 0;      ///< Bloques por página.
+		FreeNode* freeList = nullptr; ///< Bloques libres globales.
+		size_t liveSlots = 0;         ///< Bloques entregados y no devueltos a la lista global.
+		std::vector<void*> pages;     ///< Páginas reservadas.
+		mutable std::mutex mutex;     ///< Protege freeList, liveSlots y pages.
+	};
+
+	/**
+	 * @brief Pool tipado: un TFixedPool por tipo con una caché por hilo.
+	 *
+	 * Los objetos del mismo tipo comparten páginas y quedan contiguos en memoria. El pool es
+	 * un singleton que nunca se destruye, para que los objetos liberados durante la salida del
+	 * programa (destructores estáticos o de hilos) sigan teniendo a dónde volver. Si la caché
+	 * del hilo ya se destruyó, esas reservas y liberaciones van directamente al pool global.
+	 *
+	 * @tparam T Tipo de los objetos almacenados.
+	 * @tparam Tag Subsistema al que se atribuye la memoria del pool.
+	 */
+	template<typename T, EMemoryTag Tag = EMemoryTag::GENERAL>
+	class TPoolAllocator
+	{
+	public:
+		/**
+		 * @brief Reserva memoria sin construir para un T.
+		 */
+		static void* allocate()
+		{
+			if (isThreadCacheDestroyed())
+			{
+				return getPool().allocate();
+			}
+			return getThreadCache().allocate();
+		}
+
+		/**
+		 * @brief Devuelve al pool memoria obtenida con allocate(); el objeto ya debe estar destruido.
+		 */
+		static void deallocate(void* ptr)
+		{
+			if (isThreadCacheDestroyed())
+			{
+				getPool().deallocate(ptr);
+				return;
+			}
+			getThreadCache().deallocate(ptr);
+		}
+
+		/**
+		 * @brief Pool compartido por todos los hilos para el tipo T.
+		 */
+		static TFixedPool& getPool()
+		{
+			static TFixedPool* pool = new TFixedPool(sizeof(T), alignof(T), Tag);
+			return *pool;
+		}
+
+	private:
+		static TFixedPool::ThreadCache& getThreadCache()
+		{
+			thread_local TFixedPool::ThreadCache cache(getPool(), &isThreadCacheDestroyed());
+			return cache;
+		}
+
+		/**
+		 * @brief true si la caché de este hilo ya se destruyó (salida del hilo o del programa).
+		 *
+		 * Un bool thread_local no tiene destructor, así que sigue siendo válido después de que
+		 * se destruya la caché.
+		 */
+		static bool& isThreadCacheDestroyed()
+		{
+			thread_local bool destroyed = false;
+			return destroyed;
+		}
+	};
+
+	/**
+	 * @brief Tamaño máximo de objeto que TPooled sirve desde un pool.
+	 */
+	constexpr size_t PoolMaxObjectSize = 16 * 1024;
+
+	/**
+	 * @brief Base CRTP que hace que new/delete de T usen TPoolAllocator<T>.
+	 *
+	 * Basta con heredar de TPooled<T> para que new T, MakeUnique<T> o MakeRef<T> usen el pool.
+	 * Las clases derivadas de T con distinto tamaño, y los tipos mayores de PoolMaxObjectSize,
+	 * siguen usando el heap global. Para borrar por un puntero a la base, T debe tener
+	 * destructor virtual: así delete recibe el tamaño real del objeto.
+	 *
+	 * @tparam T Clase que hereda de TPooled<T>.
+	 * @tparam Tag Subsistema al que se atribuye la memoria del pool.
+	 */
+	template<typename T, EMemoryTag Tag = EMemoryTag::GENERAL>
+	class TPooled
+	{
+	public:
+		static void* operator new(size_t size)
+		{
+			if (size == sizeof(T) && sizeof(T) <= PoolMaxObjectSize)
+			{
+				return TPoolAllocator<T, Tag>::allocate();
+			}
+			return ::operator new(size);
+		}
+
+		static void operator delete(void* ptr, size_t size)
+		{
+			if (!ptr)
+			{
+				return;
+			}
+			if (size == sizeof(T) && sizeof(T) <= PoolMaxObjectSize)
+			{
+				TPoolAllocator<T, Tag>::deallocate(ptr);
+				return;
+			}
+			::operator delete(ptr);
+		}
+
+		static void* operator new[](size_t size) { return ::operator new(size); }
+		static void operator delete[](void* ptr) { ::operator delete(ptr); }
+	};
+
+	// EXAMPLE
+
+	/*
+	struct Particle : public EU::TPooled<Particle>
+	{
+		float Position[3];
+		float Velocity[3];
+	};
+
+	int main()
+	{
+		std::vector<Particle*> Particles;
+		for (int Frame = 0; Frame < 100; ++Frame)
+		{
+			for (int i = 0; i < 1000; ++i)
+				Particles.push_back(new Particle());        // Sale de la caché del hilo
+			for (Particle* P : Particles)
+				delete P;                                   // Vuelve a la lista libre, sin tocar el heap
+			Particles.clear();
+		}
+
+		// Tras el primer frame ya no se reservan más páginas
+		std::cout << EU::TPoolAllocator<Particle>::getPool().getPageCount() << std::endl;
+
+		return 0;
+	}
+	*/
+}
\ No newline at end of file
@@ -0,0 +1,337 @@
+﻿/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "TSharedPointer.h"
+
+namespace EU {
+	/**
+	 * @brief Clase base para objetos con recuento de referencias intrusivo.
+	 *
+	 * El recuento vive dentro del propio objeto, así que TRefPtr ocupa una sola palabra y no
+	 * hay un bloque de control aparte. El objeto se destruye con delete cuando el último
+	 * TRefPtr lo suelta, por lo que debe reservarse con new (o MakeRef). Copiar el objeto no
+	 * copia su recuento.
+	 *
+	 * @tparam Mode Política del recuento (ver ESPMode); por defecto no atómico.
+	 */
+	template<ESPMode Mode = ESPMode::NotThreadSafe>
+	class TRefCounted
+	{
+		using Policy = Detail::TRefCounterPolicy<Mode>;
+
+	public:
+		TRefCounted() : refCount(0) {}
+		TRefCounted(const TRefCounted&) : refCount(0) {}
+		TRefCounted& operator=(const TRefCounted&) { return *this; }
+
+		/**
+		 * @brief Incrementa el recuento de referencias.
+		 */
+		void addRef() const { Policy::increment(refCount); }
+
+		/**
+		 * @brief Decrementa el recuento y destruye el objeto al llegar a cero.
+		 */
+		void release() const
+		{
+			if (Policy::decrement(refCount))
+			{
+				delete this;
+			}
+		}
+
+		/**
+		 * @brief Número de TRefPtr que apuntan al objeto.
+		 */
+		int getRefCount() const { return Policy::load(refCount); }
+
+	protected:
+		virtual ~TRefCounted() = default;
+
+	private:
+		mutable typename Policy::CounterType refCount; ///< Recuento de referencias intrusivo.
+	};
+
+	/**
+	 * @brief Base intrusiva para objetos usados desde un solo hilo.
+	 */
+	using RefCounted = TRefCounted<ESPMode::NotThreadSafe>;
+
+	/**
+	 * @brief Base intrusiva con recuento atómico.
+	 */
+	using ThreadSafeRefCounted = TRefCounted<ESPMode::ThreadSafe>;
+
+	/**
+	 * @brief Puntero con recuento de referencias intrusivo.
+	 *
+	 * Funciona con cualquier tipo que ofrezca addRef() y release(), normalmente derivado de
+	 * RefCounted. Ocupa lo mismo que un puntero crudo; las conversiones entre tipos base y
+	 * derivados no crean bloques ni tocan otra línea de caché, y construir un TRefPtr desde
+	 * un puntero crudo ya gestionado es seguro porque el recuento está en el objeto.
+	 *
+	 * @tparam T Tipo del objeto apuntado.
+	 */
+	template<typename T>
+	class TRefPtr
+	{
+	public:
+		/**
+		 * @brief Constructor por defecto: puntero nulo.
+		 */
+		TRefPtr() : ptr(nullptr) {}
+
+		/**
+		 * @brief Constructor desde nullptr.
+		 */
+		TRefPtr(std::nullptr_t) : ptr(nullptr) {}
+
+		/**
+		 * @brief Constructor desde un puntero crudo; incrementa su recuento.
+		 *
+		 * @param rawPtr Objeto al que se va a apuntar.
+		 */
+		TRefPtr(T* rawPtr) : ptr(rawPtr)
+		{
+			if (ptr)
+			{
+				ptr->addRef();
+			}
+		}
+
+		/**
+		 * @brief Constructor de copia.
+		 */
+		TRefPtr(const TRefPtr& other) : ptr(other.ptr)
+		{
+			if (ptr)
+			{
+				ptr->addRef();
+			}
+		}
+
+		/**
+		 * @brief Constructor de copia desde un tipo derivado.
+		 */
+		template<typename U, typename = std::enable_if_t<std::is_convertible<U*, T*>::value>>
+		TRefPtr(const TRefPtr<U>& other) : ptr(other.get())
+		{
+			if (ptr)
+			{
+				ptr->addRef();
+			}
+		}
+
+		/**
+		 * @brief Constructor de movimiento: no toca el recuento.
+		 */
+		TRefPtr(TRefPtr&& other) noexcept : ptr(other.ptr)
+		{
+			other.ptr = nullptr;
+		}
+
+		/**
+		 * @brief Constructor de movimiento desde un tipo derivado.
+		 */
+		template<typename U, typename = std::enable_if_t<std::is_convertible<U*, T*>::value>>
+		TRefPtr(TRefPtr<U>&& other) noexcept : ptr(other.detach()) {}
+
+		/**
+		 * @brief Destructor: suelta la referencia.
+		 */
+		~TRefPtr()
+		{
+			if (ptr)
+			{
+				ptr->release();
+			}
+		}
+
+		/**
+		 * @brief Operador de asignación de copia.
+		 */
+		TRefPtr& operator=(const TRefPtr& other)
+		{
+			reset(other.ptr);
+			return *this;
+		}
+
+		/**
+		 * @brief Operador de asignación de movimiento.
+		 */
+		TRefPtr& operator=(TRefPtr&& other) noexcept
+		{
+			if (this != &other)
+			{
+				T* old = ptr;
+				ptr = other.ptr;
+				other.ptr = nullptr;
+				if (old)
+				{
+					old->release();
+				}
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Asignación desde un puntero crudo.
+		 */
+		TRefPtr& operator=(T* rawPtr)
+		{
+			reset(rawPtr);
+			return *this;
+		}
+
+		T& operator*() const { return *ptr; }
+		T* operator->() const { return ptr; }
+
+		explicit operator bool() const { return ptr != nullptr; }
+
+		/**
+		 * @brief Obtener el puntero crudo.
+		 */
+		T* get() const { return ptr; }
+
+		/**
+		 * @brief Comprobar si el puntero es nulo.
+		 */
+		bool isNull() const { return ptr == nullptr; }
+
+		/**
+		 * @brief Apunta a otro objeto (o a ninguno) soltando la referencia actual.
+		 *
+		 * @param newPtr Nuevo objeto; se incrementa su recuento antes de soltar el actual.
+		 */
+		void reset(T* newPtr = nullptr)
+		{
+			if (newPtr)
+			{
+				newPtr->addRef();
+			}
+			T* old = ptr;
+			ptr = newPtr;
+			if (old)
+			{
+				old->release();
+			}
+		}
+
+		/**
+		 * @brief Cede la referencia sin decrementar el recuento; el llamador debe llamar a release().
+		 */
+		T* detach()
+		{
+			T* old = ptr;
+			ptr = nullptr;
+			return old;
+		}
+
+		/**
+		 * @brief Intercambia el contenido con otro TRefPtr.
+		 */
+		void swap(TRefPtr& other) noexcept
+		{
+			std::swap(ptr, other.ptr);
+		}
+
+		/**
+		 * @brief Conversión estática a otro tipo de la jerarquía.
+		 */
+		template<typename U>
+		TRefPtr<U> staticCast() const
+		{
+			return TRefPtr<U>(static_cast<U*>(ptr));
+		}
+
+		/**
+		 * @brief Conversión dinámica; devuelve un TRefPtr nulo si el tipo no coincide.
+		 */
+		template<typename U>
+		TRefPtr<U> dynamicCast() const
+		{
+			return TRefPtr<U>(dynamic_cast<U*>(ptr));
+		}
+
+	private:
+		T* ptr; ///< Objeto apuntado (su recuento está dentro de él).
+	};
+
+	template<typename T, typename U>
+	bool operator==(const TRefPtr<T>& a, const TRefPtr<U>& b) { return a.get() == b.get(); }
+
+	template<typename T, typename U>
+	bool operator!=(const TRefPtr<T>& a, const TRefPtr<U>& b) { return a.get() != b.get(); }
+
+	template<typename T>
+	bool operator==(const TRefPtr<T>& a, std::nullptr_t) { return a.isNull(); }
+
+	template<typename T>
+	bool operator!=(const TRefPtr<T>& a, std::nullptr_t) { return !a.isNull(); }
+
+	/**
+	 * @brief Función de utilidad para crear un objeto con recuento intrusivo.
+	 *
+	 * @tparam T Tipo del objeto, derivado de TRefCounted.
+	 * @param args Argumentos reenviados al constructor de T.
+	 * @return Un TRefPtr al nuevo objeto, con recuento 1.
+	 */
+	template<typename T, typename... Args>
+	TRefPtr<T> MakeRef(Args&&... args)
+	{
+		return TRefPtr<T>(new T(std::forward<Args>(args)...));
+	}
+
+	static_assert(sizeof(TRefPtr<RefCounted>) == sizeof(void*), "TRefPtr must be pointer-sized");
+
+	// EXAMPLE
+
+	/*
+	class Mesh : public EU::RefCounted
+	{
+	public:
+		int Triangles = 0;
+	};
+
+	int main()
+	{
+		EU::TRefPtr<Mesh> A = EU::MakeRef<Mesh>();
+		EU::TRefPtr<Mesh> B = A;                              // Solo incrementa el contador dentro de Mesh
+		EU::TRefPtr<EU::RefCounted> Base = B;                 // Conversión sin bloque de control
+
+		std::cout << A->getRefCount() << std::endl;           // 3
+		std::cout << sizeof(A) << std::endl;                  // sizeof(Mesh*)
+
+		return 0;
+	}
+	*/
+}
@@ -27,19 +27,229 @@
  * SOFTWARE.
 */
 #pragma once
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "TPoolAllocator.h"
 
 namespace EU {
+	/**
+	 * @brief Política de recuento de referencias de TSharedPointer y TWeakPointer.
+	 *
+	 * NotThreadSafe usa enteros normales: es la opción por defecto y la más barata para objetos
+	 * que solo se usan desde un hilo. ThreadSafe usa contadores atómicos para poder copiar y
+	 * soltar punteros desde varios hilos (por ejemplo, assets compartidos con hilos de carga).
+	 * La política no hace thread-safe al objeto apuntado, solo a su recuento.
+	 */
+	enum class ESPMode
+	{
+		NotThreadSafe,
+		ThreadSafe
+	};
+
+	namespace Detail {
+		template<ESPMode Mode>
+		struct TRefCounterPolicy;
+
+		/**
+		 * @brief Contadores sin sincronización, para uso dentro de un solo hilo.
+		 */
+		template<>
+		struct TRefCounterPolicy<ESPMode::NotThreadSafe>
+		{
+			using CounterType = int32_t;
+
+			static void increment(CounterType& counter) { ++counter; }
+			static bool decrement(CounterType& counter) { return --counter == 0; }
+			static int32_t load(const CounterType& counter) { return counter; }
+
+			static bool incrementIfNotZero(CounterType& counter)
+			{
+				if (counter == 0)
+				{
+					return false;
+				}
+				++counter;
+				return true;
+			}
+		};
+
+		/**
+		 * @brief Contadores atómicos.
+		 *
+		 * El incremento es relaxed: quien incrementa ya tiene una referencia válida. El
+		 * decremento es acq_rel para que el hilo que libera el objeto vea todas las escrituras
+		 * previas de los demás propietarios.
+		 */
+		template<>
+		struct TRefCounterPolicy<ESPMode::ThreadSafe>
+		{
+			using CounterType = std::atomic<int32_t>;
+
+			static void increment(CounterType& counter) { counter.fetch_add(1, std::memory_order_relaxed); }
+			static bool decrement(CounterType& counter) { return counter.fetch_sub(1, std::memory_order_acq_rel) == 1; }
+			static int32_t load(const CounterType& counter) { return counter.load(std::memory_order_acquire); }
+
+			/**
+			 * @brief Incrementa solo si el objeto sigue vivo; base de TWeakPointer::lock sin locks.
+			 */
+			static bool incrementIfNotZero(CounterType& counter)
+			{
+				int32_t expected = counter.load(std::memory_order_relaxed);
+				while (expected != 0)
+				{
+					if (counter.compare_exchange_weak(expected, expected + 1,
+						std::memory_order_acquire, std::memory_order_relaxed))
+					{
+						return true;
+					}
+				}
+				return false;
+			}
+		};
+
+		/**
+		 * @brief Bloque de control de TSharedPointer: guarda los recuentos y sabe destruir el objeto.
+		 *
+		 * sharedCount cuenta los TSharedPointer; weakCount cuenta los TWeakPointer más uno que
+		 * comparten entre todos los TSharedPointer. El objeto se destruye cuando sharedCount
+		 * llega a cero y el bloque se libera cuando llega a cero weakCount, así un TWeakPointer
+		 * nunca lee un bloque ya liberado.
+		 *
+		 * Existen dos variantes: una para punteros adoptados desde new (objeto y bloque separados)
+		 * y otra usada por MakeShared, en la que el objeto vive dentro del propio bloque.
+		 */
+		template<ESPMode Mode>
+		class TSharedControlBlock
+		{
+			using Policy = TRefCounterPolicy<Mode>;
+
+		public:
+			TSharedControlBlock() : sharedCount(1), weakCount(1) {}
+			virtual ~TSharedControlBlock() = default;
+
+			/**
+			 * @brief Incrementa el recuento de referencias fuertes.
+			 */
+			void addRef() { Policy::increment(sharedCount); }
+
+			/**
+			 * @brief Incrementa el recuento fuerte solo si el objeto no ha sido destruido.
+			 *
+			 * @return true si se obtuvo una referencia.
+			 */
+			bool tryAddRef() { return Policy::incrementIfNotZero(sharedCount); }
+
+			/**
+			 * @brief Decrementa el recuento fuerte y destruye el objeto al llegar a cero.
+			 */
+			void release()
+			{
+				if (Policy::decrement(sharedCount))
+				{
+					destroyObject();
+					releaseWeak();
+				}
+			}
+
+			/**
+			 * @brief Incrementa el recuento de referencias débiles.
+			 */
+			void addWeakRef() { Policy::increment(weakCount); }
+
+			/**
+			 * @brief Decrementa el recuento débil y libera el bloque al llegar a cero.
+			 */
+			void releaseWeak()
+			{
+				if (Policy::decrement(weakCount))
+				{
+					delete this;
+				}
+			}
+
+			/**
+			 * @brief Número de TSharedPointer que comparten el objeto.
+			 */
+			int getRefCount() const { return Policy::load(sharedCount); }
+
+		protected:
+			/**
+			 * @brief Destruye el objeto gestionado sin liberar el bloque.
+			 */
+			virtual void destroyObject() = 0;
+
+		private:
+			typename Policy::CounterType sharedCount; ///< Recuento de referencias fuertes.
+			typename Policy::CounterType weakCount;   ///< Referencias débiles (+1 mientras haya fuertes).
+		};
+
+		/**
+		 * @brief Bloque de control para un objeto reservado por separado con new.
+		 *
+		 * Todos estos bloques tienen el mismo tamaño, así que salen de un pool.
+		 */
+		template<typename T, ESPMode Mode>
+		class TSharedPointerBlock : public TSharedControlBlock<Mode>, public TPooled<TSharedPointerBlock<T, Mode>>
+		{
+		public:
+			explicit TSharedPointerBlock(T* inPtr) : ptr(inPtr) {}
+
+		protected:
+			void destroyObject() override { delete ptr; }
+
+		private:
+			T* ptr; ///< Objeto adoptado.
+		};
+
+		/**
+		 * @brief Bloque de control que contiene el objeto: una sola reserva alineada para ambos.
+		 *
+		 * El bloque sale del pool de su tipo, de modo que los objetos creados con MakeShared
+		 * quedan contiguos y crearlos y destruirlos en masa no fragmenta el heap.
+		 */
+		template<typename T, ESPMode Mode>
+		class TSharedInlineBlock : public TSharedControlBlock<Mode>, public TPooled<TSharedInlineBlock<T, Mode>>
+		{
+		public:
+			template<typename... Args>
+			explicit TSharedInlineBlock(Args&&... args)
+			{
+				::new (static_cast<void*>(storage)) T(std::forward<Args>(args)...);
+			}
+
+			/**
+			 * @brief Puntero al objeto almacenado dentro del bloque.
+			 */
+			T* get() { return std::launder(reinterpret_cast<T*>(storage)); }
+
+		protected:
+			void destroyObject() override { get()->~T(); }
+
+		private:
+			alignas(T) unsigned char storage[sizeof(T)]; ///< Memoria del objeto.
+		};
+	}
+
 	/**
 	 * @brief Clase TSharedPointer para manejar la gestión de memoria compartida.
 	 *
 	 * La clase TSharedPointer gestiona la memoria de un objeto de tipo T y lleva un
 	 * recuento de referencias para permitir la compartición segura de un mismo objeto
-	 * en múltiples instancias de TSharedPointer.
+	 * en múltiples instancias de TSharedPointer. El recuento vive en un bloque de control;
+	 * con MakeShared el objeto se construye dentro de ese mismo bloque.
+	 *
+	 * @tparam T Tipo del objeto gestionado.
+	 * @tparam Mode Política del recuento (ver ESPMode); por defecto no atómico.
 	 */
-	template<typename T>
+	template<typename T, ESPMode Mode = ESPMode::NotThreadSafe>
 	class TSharedPointer
 	{
 	public:
+		using ControlBlock = Detail::TSharedControlBlock<Mode>;
+
 		/**
 		 * @brief Constructor por defecto.
 		 *
@@ -50,21 +260,25 @@ namespace EU {
 		/**
 		 * @brief Constructor que toma un puntero crudo.
 		 *
+		 * Reserva un bloque de control aparte; para objetos nuevos es preferible MakeShared,
+		 * que hace una sola reserva.
+		 *
 		 * @param rawPtr Puntero crudo al objeto que se va a gestionar.
 		 */
-		explicit TSharedPointer(T* rawPtr) : ptr(rawPtr), refCount(new int(1)) {}
+		explicit TSharedPointer(T* rawPtr)
+			: ptr(rawPtr), refCount(rawPtr ? new Detail::TSharedPointerBlock<T, Mode>(rawPtr) : nullptr) {}
 
 		/**
-		 * @brief Constructor desde un puntero crudo y un recuento de referencias.
+		 * @brief Constructor desde un puntero crudo y un bloque de control existente.
 		 *
 		 * @param rawPtr Puntero crudo al objeto gestionado.
-		 * @param existingRefCount Puntero al recuento de referencias existente.
+		 * @param existingRefCount Bloque de control existente; se incrementa su recuento.
 		 */
-		TSharedPointer(T* rawPtr, int* existingRefCount) : ptr(rawPtr), refCount(existingRefCount)
+		TSharedPointer(T* rawPtr, ControlBlock* existingRefCount) : ptr(rawPtr), refCount(existingRefCount)
 		{
 			if (refCount)
 			{
-				++(*refCount);
+				refCount->addRef();
 			}
 		}
 
@@ -76,11 +290,11 @@ namespace EU {
 		 *
 		 * @param other Otro objeto TSharedPointer del mismo tipo T.
 		 */
-		TSharedPointer(const TSharedPointer<T>& other) : ptr(other.ptr), refCount(other.refCount)
+		TSharedPointer(const TSharedPointer& other) : ptr(other.ptr), refCount(other.refCount)
 		{
 			if (refCount)
 			{
-				++(*refCount);
+				refCount->addRef();
 			}
 		}
 
@@ -92,7 +306,7 @@ namespace EU {
 		 *
 		 * @param other Otro objeto TSharedPointer del mismo tipo T.
 		 */
-		TSharedPointer(TSharedPointer<T>&& other) noexcept : ptr(other.ptr), refCount(other.refCount)
+		TSharedPointer(TSharedPointer&& other) noexcept : ptr(other.ptr), refCount(other.refCount)
 		{
 			other.ptr = nullptr;
 			other.refCount = nullptr;
@@ -107,23 +321,23 @@ namespace EU {
 		 * @param other Otro objeto TSharedPointer del mismo tipo T.
 		 * @return Referencia al objeto TSharedPointer actual.
 		 */
-		TSharedPointer<T>& operator=(const TSharedPointer<T>& other)
+		TSharedPointer& operator=(const TSharedPointer& other)
 		{
 			if (this != &other)
 			{
+				// Aumentar primero el recuento del otro por si ambos comparten bloque
+				if (other.refCount)
+				{
+					other.refCount->addRef();
+				}
 				// Disminuir el recuento de referencias del objeto actual
-				if (refCount && --(*refCount) == 0)
+				if (refCount)
 				{
-					delete ptr;
-					delete refCount;
+					refCount->release();
 				}
 				// Copiar datos del otro puntero compartido
 				ptr = other.ptr;
 				refCount = other.refCount;
-				if (refCount)
-				{
-					++(*refCount);
-				}
 			}
 			return *this;
 		}
@@ -137,15 +351,14 @@ namespace EU {
 		 * @param other Otro objeto TSharedPointer del mismo tipo T.
 		 * @return Referencia al objeto TSharedPointer actual.
 		 */
-		TSharedPointer<T>& operator=(TSharedPointer<T>&& other) noexcept
+		TSharedPointer& operator=(TSharedPointer&& other) noexcept
 		{
 			if (this != &other)
 			{
 				// Liberar el objeto actual
-				if (refCount && --(*refCount) == 0)
+				if (refCount)
 				{
-					delete ptr;
-					delete refCount;
+					refCount->release();
 				}
 				// Transferir los datos del otro puntero compartido
 				ptr = other.ptr;
@@ -164,10 +377,9 @@ namespace EU {
 		 */
 		~TSharedPointer()
 		{
-			if (refCount && --(*refCount) == 0)
+			if (refCount)
 			{
-				delete ptr;
-				delete refCount;
+				refCount->release();
 			}
 		}
 
@@ -204,10 +416,15 @@ namespace EU {
 		 */
 		bool isNull() const { return ptr == nullptr; }
 
+		/**
+		 * @brief Número de TSharedPointer que comparten el objeto (0 si es nulo).
+		 */
+		int useCount() const { return refCount ? refCount->getRefCount() : 0; }
+
 
 	public:
 		T* ptr;       ///< Puntero al objeto gestionado.
-		int* refCount; ///< Puntero al recuento de referencias.
+		ControlBlock* refCount; ///< Bloque de control con el recuento de referencias.
 
 		/**
 		 * @brief Método swap.
@@ -216,10 +433,10 @@ namespace EU {
 		 *
 		 * @param other Otro objeto TSharedPointer del mismo tipo T.
 		 */
-		void swap(TSharedPointer<T>& other) noexcept
+		void swap(TSharedPointer& other) noexcept
 		{
 			T* tempPtr = other.ptr;
-			int* tempRefCount = other.refCount;
+			ControlBlock* tempRefCount = other.refCount;
 
 			other.ptr = this->ptr;
 			other.refCount = this->refCount;
@@ -236,10 +453,9 @@ namespace EU {
 		void reset(T* newPtr = nullptr)
 		{
 			// Disminuir el recuento de referencias del objeto actual
-			if (refCount && --(*refCount) == 0)
+			if (refCount)
 			{
-				delete ptr;
-				delete refCount;
+				refCount->release();
 			}
 
 			// Si newPtr es nullptr, asignar nullptr al puntero y recuento de referencias
@@ -252,22 +468,22 @@ namespace EU {
 			{
 				// Asignar nuevo objeto y manejar el recuento de referencias
 				ptr = newPtr;
-				refCount = new int(1);
+				refCount = new Detail::TSharedPointerBlock<T, Mode>(newPtr);
 			}
 		}
 
 		// Método de conversión para hacer cast dinámico
 		template<typename U>
-		TSharedPointer<U> dynamic_pointer_cast() const {
+		TSharedPointer<U, Mode> dynamic_pointer_cast() const {
 			// Intenta convertir el puntero de tipo T a U
 			U* castedPtr = dynamic_cast<U*>(ptr);
 			if (castedPtr) {
 				// Si la conversión es exitosa, devuelve un nuevo TSharedPointer<U>
-				return TSharedPointer<U>(castedPtr, refCount);
+				return TSharedPointer<U, Mode>(castedPtr, refCount);
 			}
 			else {
 				// Si falla la conversión, devuelve un TSharedPointer<U> nulo
-				return TSharedPointer<U>();
+				return TSharedPointer<U, Mode>();
 			}
 		}
 	};
@@ -275,14 +491,29 @@ namespace EU {
 	/**
 	 * @brief Función de utilidad para crear un TSharedPointer.
 	 *
+	 * Reenvía los argumentos al constructor de T sin copiarlos y construye el objeto dentro
+	 * del bloque de control, así que objeto y recuento comparten una única reserva alineada
+	 * y quedan contiguos en memoria.
+	 *
 	 * @tparam T Tipo del objeto gestionado.
+	 * @tparam Mode Política del recuento; ESPMode::ThreadSafe para objetos compartidos entre hilos.
 	 * @tparam Args Tipos de los argumentos del constructor del objeto gestionado.
 	 * @param args Argumentos del constructor del objeto gestionado.
 	 * @return Un objeto TSharedPointer gestionando un nuevo objeto de tipo T.
 	 */
-	template<typename T, typename... Args>
-	TSharedPointer<T> MakeShared(Args... args)
+	template<typename T, ESPMode Mode = ESPMode::NotThreadSafe, typename... Args>
+	TSharedPointer<T, Mode> MakeShared(Args&&... args)
 	{
-		return TSharedPointer<T>(new T(args...));
+		Detail::TSharedInlineBlock<T, Mode>* block = new Detail::TSharedInlineBlock<T, Mode>(std::forward<Args>(args)...);
+		TSharedPointer<T, Mode> result;
+		result.ptr = block->get();
+		result.refCount = block;
+		return result;
 	}
+
+	/**
+	 * @brief Alias para punteros compartidos cuyo recuento se modifica desde varios hilos.
+	 */
+	template<typename T>
+	using TThreadSafeSharedPointer = TSharedPointer<T, ESPMode::ThreadSafe>;
 }
\ No newline at end of file
@@ -0,0 +1,310 @@
+﻿/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <vector>
+#include "TMemoryTracker.h"
+#include "TLinearArena.h"
+
+namespace EU {
+	/**
+	 * @brief Asignador de pila con marcadores para memoria temporal con ámbito.
+	 *
+	 * Reservar avanza la cima de la pila; getMarker() anota la cima y freeToMarker() vuelve a
+	 * ella liberando de golpe todo lo reservado después. La pila se compone de bloques: si el
+	 * bloque actual no tiene sitio se pasa al siguiente (o se reserva uno nuevo del doble de
+	 * tamaño), y los bloques liberados por un marcador se conservan para reutilizarlos, así que
+	 * tras la primera carga grande no se vuelve a pedir memoria al sistema.
+	 */
+	class TStackAllocator
+	{
+	public:
+		/**
+		 * @brief Posición de la cima de la pila.
+		 */
+		struct Marker
+		{
+			size_t block = 0;  ///< Bloque activo.
+			size_t offset = 0; ///< Bytes usados en ese bloque.
+		};
+
+		TStackAllocator() = default;
+
+		/**
+		 * @brief Crea la pila con un primer bloque de la capacidad indicada.
+		 *
+		 * @param capacity Bytes del primer bloque.
+		 * @param inTag Subsistema al que se atribuye la memoria.
+		 */
+		explicit TStackAllocator(size_t capacity, EMemoryTag inTag = EMemoryTag::GENERAL)
+		{
+			init(capacity, inTag);
+		}
+
+		~TStackAllocator() { releaseBlocks(); }
+
+		TStackAllocator(const TStackAllocator&) = delete;
+		TStackAllocator& operator=(const TStackAllocator&) = delete;
+
+		/**
+		 * @brief (Re)inicializa la pila con un primer bloque; invalida toda la memoria servida.
+		 *
+		 * @param capacity Bytes del primer bloque.
+		 * @param inTag Subsistema al que se atribuye la memoria.
+		 */
+		void init(size_t capacity, EMemoryTag inTag = EMemoryTag::GENERAL)
+		{
+			releaseBlocks();
+			tag = inTag;
+			top = Marker();
+			peakBytes = 0;
+			if (capacity)
+			{
+				addBlock(capacity);
+			}
+		}
+
+		/**
+		 * @brief Reserva memoria sin inicializar en la cima de la pila.
+		 *
+		 * @param size Bytes a reservar.
+		 * @param alignment Alineación requerida (potencia de dos).
+		 * @return Puntero válido hasta que se libere un marcador anterior a esta reserva.
+		 */
+		void* allocate(size_t size, size_t alignment = alignof(std::max_align_t))
+		{
+			while (true)
+			{
+				if (top.block < blocks.size())
+				{
+					Block& block = blocks[top.block];
+					uintptr_t current = reinterpret_cast<uintptr_t>(block.data) + top.offset;
+					uintptr_t aligned = (current + (alignment - 1)) & ~(uintptr_t)(alignment - 1);
+					size_t newOffset = top.offset + (aligned - current) + size;
+					if (newOffset <= block.capacity)
+					{
+						top.offset = newOffset;
+						size_t used = getUsed();
+						if (used > peakBytes)
+						{
+							peakBytes = used;
+						}
+						return reinterpret_cast<void*>(aligned);
+					}
+				}
+
+				// El bloque actual no basta: se pasa al siguiente libre o se crea uno mayor
+				size_t next = blocks.empty() ? 0 : top.block + 1;
+				if (next >= blocks.size())
+				{
+					size_t lastCapacity = blocks.empty() ? 0 : blocks.back().capacity;
+					size_t capacity = lastCapacity * 2;
+					if (capacity < size + alignment)
+					{
+						capacity = size + alignment;
+					}
+					addBlock(capacity);
+					next = blocks.size() - 1;
+				}
+				blockStartUsed.resize(blocks.size());
+				blockStartUsed[next] = blocks.size() > 1 ? getUsed() : 0;
+				top.block = next;
+				top.offset = 0;
+			}
+		}
+
+		/**
+		 * @brief Reserva espacio sin inicializar para count elementos de tipo T.
+		 */
+		template<typename T>
+		T* allocateArray(size_t count)
+		{
+			return static_cast<T*>(allocate(count * sizeof(T), alignof(T)));
+		}
+
+		/**
+		 * @brief Devuelve memoria si es la última reserva de la pila; si no, no hace nada.
+		 *
+		 * Permite que un contenedor en la cima crezca sin dejar huecos.
+		 *
+		 * @param ptr Puntero devuelto por allocate().
+		 * @param size Tamaño con el que se reservó.
+		 */
+		void deallocate(void* ptr, size_t size)
+		{
+			if (!ptr || top.block >= blocks.size())
+			{
+				return;
+			}
+			unsigned char* bytes = static_cast<unsigned char*>(ptr);
+			Block& block = blocks[top.block];
+			if (bytes >= block.data && bytes + size == block.data + top.offset)
+			{
+				top.offset = static_cast<size_t>(bytes - block.data);
+			}
+		}
+
+		/**
+		 * @brief Posición actual de la cima.
+		 */
+		Marker getMarker() const { return top; }
+
+		/**
+		 * @brief Libera todo lo reservado después del marcador.
+		 *
+		 * @param marker Valor devuelto por getMarker(); los marcadores posteriores quedan invalidados.
+		 */
+		void freeToMarker(Marker marker)
+		{
+			top = marker;
+		}
+
+		/**
+		 * @brief Vacía la pila conservando todos sus bloques.
+		 */
+		void reset()
+		{
+			top = Marker();
+		}
+
+		/**
+		 * @brief Bytes en uso, contando el relleno de alineación.
+		 */
+		size_t getUsed() const
+		{
+			size_t start = top.block < blockStartUsed.size() ? blockStartUsed[top.block] : 0;
+			return start + top.offset;
+		}
+
+		/**
+		 * @brief Suma de la capacidad de todos los bloques.
+		 */
+		size_t getCapacity() const
+		{
+			size_t total = 0;
+			for (const Block& block : blocks)
+			{
+				total += block.capacity;
+			}
+			return total;
+		}
+
+		/**
+		 * @brief Máximo de bytes en uso desde init().
+		 */
+		size_t getPeak() const { return peakBytes; }
+
+	private:
+		/**
+		 * @brief Bloque de memoria contiguo de la pila.
+		 */
+		struct Block
+		{
+			unsigned char* data; ///< Memoria del bloque.
+			size_t capacity;     ///< Bytes del bloque.
+		};
+
+		void addBlock(size_t capacity)
+		{
+			unsigned char* data = static_cast<unsigned char*>(std::malloc(capacity));
+			if (!data)
+			{
+				throw std::bad_alloc();
+			}
+			TMemoryTracker::get().recordAlloc(tag, capacity);
+			blocks.push_back({ data, capacity });
+		}
+
+		void releaseBlocks()
+		{
+			for (Block& block : blocks)
+			{
+				TMemoryTracker::get().recordFree(tag, block.capacity);
+				std::free(block.data);
+			}
+			blocks.clear();
+			blockStartUsed.clear();
+		}
+
+		EMemoryTag tag = EMemoryTag::GENERAL; ///< Etiqueta de memoria de los bloques.
+		std::vector<Block> blocks;            ///< Bloques reservados, en orden de uso.
+		std::vector<size_t> blockStartUsed;   ///< Bytes en uso al entrar en cada bloque.
+		Marker top;                           ///< Cima de la pila.
+		size_t peakBytes = 0;                 ///< Pico de uso.
+	};
+
+	/**
+	 * @brief Ámbito RAII: anota la cima al crearse y la restaura al destruirse.
+	 */
+	class TStackScope
+	{
+	public:
+		explicit TStackScope(TStackAllocator& inStack) : stack(inStack), marker(inStack.getMarker()) {}
+		~TStackScope() { stack.freeToMarker(marker); }
+
+		TStackScope(const TStackScope&) = delete;
+		TStackScope& operator=(const TStackScope&) = delete;
+
+	private:
+		TStackAllocator& stack;           ///< Pila restaurada al salir.
+		TStackAllocator::Marker marker;   ///< Cima al entrar en el ámbito.
+	};
+
+	/**
+	 * @brief std::vector cuya memoria vive en un TStackAllocator.
+	 */
+	template<typename T>
+	using TStackVector = std::vector<T, TArenaAllocator<T, TStackAllocator>>;
+
+	// EXAMPLE
+
+	/*
+	int main()
+	{
+		EU::TStackAllocator Scratch(1024 * 1024, EU::EMemoryTag::LOADER);
+
+		for (int Mesh = 0; Mesh < 100; ++Mesh)
+		{
+			EU::TStackScope Scope(Scratch);                 // Todo lo de esta iteración se libera al salir
+
+			float* Positions = Scratch.allocateArray<float>(3 * 100000);
+			EU::TStackVector<unsigned int> Indices{ EU::TArenaAllocator<unsigned int, EU::TStackAllocator>(Scratch) };
+			Indices.reserve(300000);
+			Positions[0] = 0.0f;
+		}
+
+		std::cout << "peak: " << Scratch.getPeak() << " capacity: " << Scratch.getCapacity() << std::endl;
+
+		return 0;
+	}
+	*/
+}
\ No newline at end of file
@@ -0,0 +1,795 @@
+﻿/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <vector>
+#include "TMemoryTracker.h"
+#include "TLinearArena.h"
+#include "TAlignedAllocator.h"
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace EU {
+	namespace Detail {
+		/**
+		 * @brief Índice del bit más significativo a 1 (value != 0).
+		 */
+		inline int FindLastSet(uint64_t value)
+		{
+#if defined(_MSC_VER)
+			unsigned long index;
+			_BitScanReverse64(&index, value);
+			return static_cast<int>(index);
+#else
+			return 63 - __builtin_clzll(value);
+#endif
+		}
+
+		/**
+		 * @brief Índice del bit menos significativo a 1 (value != 0).
+		 */
+		inline int FindFirstSet(uint32_t value)
+		{
+#if defined(_MSC_VER)
+			unsigned long index;
+			_BitScanForward(&index, value);
+			return static_cast<int>(index);
+#else
+			return __builtin_ctz(value);
+#endif
+		}
+	}
+
+	/**
+	 * @brief Heap TLSF (Two-Level Segregated Fit) sobre regiones de memoria propias del motor.
+	 *
+	 * Los bloques libres se clasifican en listas por dos niveles de tamaño: el primero es la
+	 * potencia de dos y el segundo divide cada potencia en 32 tramos. Dos mapas de bits indican
+	 * qué listas tienen bloques, así que encontrar un bloque adecuado, partirlo y fusionar al
+	 * liberar son operaciones O(1) sin bucles que dependan del número de bloques: la latencia
+	 * es determinista. La búsqueda redondea al tramo siguiente (good fit), lo que acota la
+	 * fragmentación interna a ~3%.
+	 *
+	 * Cada bloque lleva una cabecera de 16 bytes con el bloque físico anterior y su tamaño, de
+	 * modo que todas las direcciones devueltas están alineadas a 16 bytes (aptas para SSE);
+	 * alineaciones mayores se sirven recortando el hueco inicial como bloque libre.
+	 *
+	 * No es thread-safe: cada heap pertenece a un sistema o se protege externamente.
+	 */
+	class TTLSFHeap
+	{
+	public:
+		/**
+		 * @brief Alineación garantizada de todas las reservas.
+		 */
+		static constexpr size_t Alignment = 16;
+
+		TTLSFHeap() { clearLists(); }
+
+		/**
+		 * @brief Crea el heap con una región propia de la capacidad indicada.
+		 *
+		 * @param capacity Bytes de la región.
+		 * @param inTag Subsistema al que se atribuye la región.
+		 * @param largePages Respaldar la región con páginas grandes si el sistema lo permite.
+		 */
+		explicit TTLSFHeap(size_t capacity, EMemoryTag inTag = EMemoryTag::GENERAL, bool largePages = false)
+		{
+			clearLists();
+			init(capacity, inTag, largePages);
+		}
+
+		~TTLSFHeap() { releaseRegions(); }
+
+		TTLSFHeap(const TTLSFHeap&) = delete;
+		TTLSFHeap& operator=(const TTLSFHeap&) = delete;
+
+		/**
+		 * @brief (Re)inicializa el heap con una región propia; invalida toda la memoria servida.
+		 *
+		 * @param capacity Bytes de la región.
+		 * @param inTag Subsistema al que se atribuye la región.
+		 * @param largePages Respaldar la región con páginas grandes si el sistema lo permite.
+		 */
+		void init(size_t capacity, EMemoryTag inTag = EMemoryTag::GENERAL, bool largePages = false)
+		{
+			releaseRegions();
+			clearLists();
+			PageAllocation region = AllocatePages(capacity, largePages, inTag);
+			if (!region.memory)
+			{
+				throw std::bad_alloc();
+			}
+			ownedRegions.push_back(region);
+			addRegion(region.memory, region.bytes);
+		}
+
+		/**
+		 * @brief Añade al heap memoria externa; el heap no la libera.
+		 *
+		 * @param memory Inicio de la región.
+		 * @param bytes Tamaño de la región.
+		 * @return false si la región es demasiado pequeña.
+		 */
+		bool addRegion(void* memory, size_t bytes)
+		{
+			uintptr_t start = alignUp(reinterpret_cast<uintptr_t>(memory), Alignment);
+			size_t adjust = static_cast<size_t>(start - reinterpret_cast<uintptr_t>(memory));
+			if (bytes < adjust + 2 * HeaderSize + MinBlockSize)
+			{
+				return false;
+			}
+			size_t payload = (bytes - adjust - 2 * HeaderSize) & ~(Alignment - 1);
+			if (payload > MaxBlockSize)
+			{
+				payload = MaxBlockSize;
+			}
+
+			BlockHeader* block = reinterpret_cast<BlockHeader*>(start);
+			block->prevPhys = nullptr;
+			block->setSize(payload);
+			block->setFree(true);
+
+			// Centinela de tamaño 0 marcado como usado: impide fusionar más allá del final
+			BlockHeader* sentinel = nextPhys(block);
+			sentinel->prevPhys = block;
+			sentinel->setSize(0);
+			sentinel->setFree(false);
+
+			insertFree(block);
+			freeBytes += payload;
+			regions.push_back(block);
+			return true;
+		}
+
+		/**
+		 * @brief Reserva memoria sin inicializar.
+		 *
+		 * @param size Bytes a reservar.
+		 * @param alignment Alineación requerida (potencia de dos).
+		 * @return Puntero a la memoria, o nullptr si no hay un bloque libre suficiente.
+		 */
+		void* allocate(size_t size, size_t alignment = Alignment)
+		{
+			size_t adjusted = adjustSize(size);
+			if (adjusted == 0)
+			{
+				return nullptr;
+			}
+			if (alignment <= Alignment)
+			{
+				BlockHeader* block = locateFree(adjusted);
+				return block ? prepareUsed(block, adjusted) : nullptr;
+			}
+
+			// Se pide de más para poder recortar un hueco inicial que sea un bloque libre válido
+			const size_t gapMinimum = HeaderSize + MinBlockSize;
+			if (alignment > MaxBlockSize - gapMinimum || adjusted > MaxBlockSize - gapMinimum - alignment)
+			{
+				return nullptr;
+			}
+			BlockHeader* block = locateFree(adjustSize(adjusted + alignment + gapMinimum));
+			if (!block)
+			{
+				return nullptr;
+			}
+			uintptr_t ptr = reinterpret_cast<uintptr_t>(toPtr(block));
+			uintptr_t aligned = alignUp(ptr, alignment);
+			size_t gap = static_cast<size_t>(aligned - ptr);
+			if (gap && gap < gapMinimum)
+			{
+				aligned = alignUp(ptr + gapMinimum, alignment);
+				gap = static_cast<size_t>(aligned - ptr);
+			}
+			if (gap)
+			{
+				block = trimFreeLeading(block, gap);
+			}
+			return prepareUsed(block, adjusted);
+		}
+
+		/**
+		 * @brief Reserva espacio sin inicializar para count elementos de tipo T.
+		 */
+		template<typename T>
+		T* allocateArray(size_t count)
+		{
+			return static_cast<T*>(allocate(count * sizeof(T), alignof(T)));
+		}
+
+		/**
+		 * @brief Libera memoria obtenida de este heap y la fusiona con sus vecinos libres.
+		 */
+		void deallocate(void* ptr)
+		{
+			if (!ptr)
+			{
+				return;
+			}
+			BlockHeader* block = fromPtr(ptr);
+			usedBytes -= block->getSize();
+			freeBytes += block->getSize();
+			block->setFree(true);
+			block = mergePrev(block);
+			block = mergeNext(block);
+			insertFree(block);
+		}
+
+		/**
+		 * @brief Igual que deallocate(); firma compatible con TArenaAllocator.
+		 */
+		void deallocate(void* ptr, size_t)
+		{
+			deallocate(ptr);
+		}
+
+		/**
+		 * @brief Cambia el tamaño de una reserva, ampliándola en el sitio si el bloque siguiente está libre.
+		 *
+		 * @param ptr Reserva actual (nullptr equivale a allocate).
+		 * @param size Nuevo tamaño (0 libera y devuelve nullptr).
+		 * @param alignment Alineación de la reserva original; se respeta si hay que moverla.
+		 */
+		void* reallocate(void* ptr, size_t size, size_t alignment = Alignment)
+		{
+			if (!ptr)
+			{
+				return allocate(size, alignment);
+			}
+			if (size == 0)
+			{
+				deallocate(ptr);
+				return nullptr;
+			}
+
+			BlockHeader* block = fromPtr(ptr);
+			size_t current = block->getSize();
+			size_t adjusted = adjustSize(size);
+			if (adjusted == 0)
+			{
+				return nullptr;
+			}
+
+			BlockHeader* next = nextPhys(block);
+			size_t combined = current + (next->isFree() ? HeaderSize + next->getSize() : 0);
+			if (adjusted > current && adjusted <= combined)
+			{
+				// Crece absorbiendo el bloque siguiente
+				removeFree(next);
+				freeBytes -= next->getSize();
+				block->setSize(combined);
+				nextPhys(block)->prevPhys = block;
+				usedBytes += combined - current;
+				trimUsed(block, adjusted);
+				return ptr;
+			}
+			if (adjusted <= current)
+			{
+				trimUsed(block, adjusted);
+				return ptr;
+			}
+
+			void* result = allocate(size, alignment);
+			if (result)
+			{
+				std::memcpy(result, ptr, current);
+				deallocate(ptr);
+			}
+			return result;
+		}
+
+		/**
+		 * @brief Bytes utilizables de una reserva (puede ser mayor que lo pedido).
+		 */
+		static size_t getAllocationSize(const void* ptr)
+		{
+			return ptr ? fromPtr(const_cast<void*>(ptr))->getSize() : 0;
+		}
+
+		/**
+		 * @brief Bytes entregados al usuario, sin cabeceras.
+		 */
+		size_t getUsed() const { return usedBytes; }
+
+		/**
+		 * @brief Bytes libres en bloques, sin cabeceras.
+		 */
+		size_t getFree() const { return freeBytes; }
+
+		/**
+		 * @brief Tamaño del mayor bloque libre; con getFree() da una medida de fragmentación externa.
+		 */
+		size_t getLargestFreeBlock() const
+		{
+			if (!flBitmap)
+			{
+				return 0;
+			}
+			int fl = Detail::FindLastSet(flBitmap);
+			int sl = Detail::FindLastSet(slBitmap[fl]);
+			size_t largest = 0;
+			for (BlockHeader* block = freeLists[fl][sl]; block; block = block->nextFree)
+			{
+				if (block->getSize() > largest)
+				{
+					largest = block->getSize();
+				}
+			}
+			return largest;
+		}
+
+		/**
+		 * @brief Recorre todos los bloques y comprueba enlaces, fusiones y listas; para depuración.
+		 *
+		 * Sigue la cadena física de cada región hasta su centinela (enlaces prevPhys, bloques libres
+		 * contiguos sin fusionar, contadores de bytes) y después las listas libres y sus bitmaps.
+		 *
+		 * @return true si las estructuras internas son coherentes.
+		 */
+		bool checkIntegrity() const
+		{
+			size_t physicalFree = 0;
+			size_t physicalUsed = 0;
+			size_t physicalFreeBlocks = 0;
+			for (const BlockHeader* first : regions)
+			{
+				if (first->prevPhys)
+				{
+					return false;
+				}
+				const BlockHeader* block = first;
+				while (block->getSize() != 0 || block->isFree())
+				{
+					const BlockHeader* next = nextPhys(block);
+					if (next->prevPhys != block)
+					{
+						return false;
+					}
+					if (block->isFree())
+					{
+						if (next->isFree())
+						{
+							return false;
+						}
+						physicalFree += block->getSize();
+						++physicalFreeBlocks;
+					}
+					else
+					{
+						physicalUsed += block->getSize();
+					}
+					block = next;
+				}
+			}
+			if (physicalFree != freeBytes || physicalUsed != usedBytes)
+			{
+				return false;
+			}
+
+			size_t listedFreeBlocks = 0;
+			for (int fl = 0; fl < FLIndexCount; ++fl)
+			{
+				for (int sl = 0; sl < SLIndexCount; ++sl)
+				{
+					bool listHasBlocks = freeLists[fl][sl] != nullptr;
+					bool bitSet = (slBitmap[fl] & (1u << sl)) != 0;
+					if (listHasBlocks != bitSet)
+					{
+						return false;
+					}
+					for (BlockHeader* block = freeLists[fl][sl]; block; block = block->nextFree)
+					{
+						int blockFl;
+						int blockSl;
+						mappingInsert(block->getSize(), blockFl, blockSl);
+						if (!block->isFree() || blockFl != fl || blockSl != sl)
+						{
+							return false;
+						}
+						// Dos bloques libres contiguos deberían haberse fusionado
+						if ((block->prevPhys && block->prevPhys->isFree()) || nextPhys(block)->isFree())
+						{
+							return false;
+						}
+						++listedFreeBlocks;
+					}
+				}
+			}
+			// Todo bloque libre de la cadena física tiene que estar en alguna lista
+			return listedFreeBlocks == physicalFreeBlocks;
+		}
+
+	private:
+		/**
+		 * @brief Cabecera de bloque; en bloques libres le siguen los enlaces de su lista.
+		 */
+		struct BlockHeader
+		{
+			BlockHeader* prevPhys; ///< Bloque físico anterior (nullptr en el primero de la región).
+			size_t sizeAndFlags;   ///< Tamaño útil; el bit 0 indica bloque libre.
+			BlockHeader* nextFree; ///< Siguiente en la lista libre (solo en bloques libres).
+			BlockHeader* prevFree; ///< Anterior en la lista libre (solo en bloques libres).
+
+			size_t getSize() const { return sizeAndFlags & ~size_t(1); }
+			void setSize(size_t size) { sizeAndFlags = size | (sizeAndFlags & 1); }
+			bool isFree() const { return (sizeAndFlags & 1) != 0; }
+			void setFree(bool free) { sizeAndFlags = free ? (sizeAndFlags | 1) : (sizeAndFlags & ~size_t(1)); }
+		};
+
+		static constexpr size_t HeaderSize = 2 * sizeof(void*) <= Alignment ? Alignment : 2 * sizeof(void*);
+		static constexpr size_t MinBlockSize = 2 * sizeof(void*) <= Alignment ? Alignment : 2 * sizeof(void*);
+		static constexpr int SLIndexCountLog2 = 5;
+		static constexpr int SLIndexCount = 1 << SLIndexCountLog2;
+		static constexpr int AlignmentLog2 = 4;
+		static constexpr int FLIndexShift = SLIndexCountLog2 + AlignmentLog2;
+		static constexpr int FLIndexMax = 38;
+		static constexpr int FLIndexCount = FLIndexMax - FLIndexShift + 1;
+		static constexpr size_t SmallBlockSize = size_t(1) << FLIndexShift;
+		static constexpr size_t MaxBlockSize = (size_t(1) << FLIndexMax) - Alignment;
+
+		static_assert((size_t(1) << AlignmentLog2) == Alignment, "AlignmentLog2 must match Alignment");
+		static_assert(FLIndexCount <= 32, "First-level bitmap must fit in 32 bits");
+
+		static uintptr_t alignUp(uintptr_t value, size_t alignment)
+		{
+			return (value + (alignment - 1)) & ~(uintptr_t)(alignment - 1);
+		}
+
+		static size_t adjustSize(size_t size)
+		{
+			if (size == 0 || size > MaxBlockSize)
+			{
+				return 0;
+			}
+			size_t adjusted = static_cast<size_t>(alignUp(size, Alignment));
+			return adjusted < MinBlockSize ? MinBlockSize : adjusted;
+		}
+
+		static void* toPtr(BlockHeader* block)
+		{
+			return reinterpret_cast<unsigned char*>(block) + HeaderSize;
+		}
+
+		static BlockHeader* fromPtr(void* ptr)
+		{
+			return reinterpret_cast<BlockHeader*>(static_cast<unsigned char*>(ptr) - HeaderSize);
+		}
+
+		static BlockHeader* nextPhys(const BlockHeader* block)
+		{
+			return reinterpret_cast<BlockHeader*>(
+				reinterpret_cast<unsigned char*>(const_cast<BlockHeader*>(block)) + HeaderSize + block->getSize());
+		}
+
+		/**
+		 * @brief Lista a la que pertenece un bloque del tamaño dado.
+		 */
+		static void mappingInsert(size_t size, int& fl, int& sl)
+		{
+			if (size < SmallBlockSize)
+			{
+				fl = 0;
+				sl = static_cast<int>(size / (SmallBlockSize / SLIndexCount));
+			}
+			else
+			{
+				int last = Detail::FindLastSet(size);
+				sl = static_cast<int>(size >> (last - SLIndexCountLog2)) ^ SLIndexCount;
+				fl = last - (FLIndexShift - 1);
+			}
+		}
+
+		/**
+		 * @brief Primera lista cuyos bloques seguro que caben size bytes.
+		 */
+		static void mappingSearch(size_t size, int& fl, int& sl)
+		{
+			if (size >= SmallBlockSize)
+			{
+				size += (size_t(1) << (Detail::FindLastSet(size) - SLIndexCountLog2)) - 1;
+			}
+			mappingInsert(size, fl, sl);
+		}
+
+		BlockHeader* locateFree(size_t size)
+		{
+			int fl;
+			int sl;
+			mappingSearch(size, fl, sl);
+			if (fl >= FLIndexCount)
+			{
+				return nullptr;
+			}
+
+			uint32_t slMap = slBitmap[fl] & (~0u << sl);
+			if (!slMap)
+			{
+				uint32_t flMap = (fl + 1 < 32) ? (flBitmap & (~0u << (fl + 1))) : 0;
+				if (!flMap)
+				{
+					return nullptr;
+				}
+				fl = Detail::FindFirstSet(flMap);
+				slMap = slBitmap[fl];
+			}
+			sl = Detail::FindFirstSet(slMap);
+
+			BlockHeader* block = freeLists[fl][sl];
+			removeFreeAt(block, fl, sl);
+			freeBytes -= block->getSize();
+			return block;
+		}
+
+		void insertFree(BlockHeader* block)
+		{
+			int fl;
+			int sl;
+			mappingInsert(block->getSize(), fl, sl);
+			BlockHeader* head = freeLists[fl][sl];
+			block->nextFree = head;
+			block->prevFree = nullptr;
+			if (head)
+			{
+				head->prevFree = block;
+			}
+			freeLists[fl][sl] = block;
+			flBitmap |= 1u << fl;
+			slBitmap[fl] |= 1u << sl;
+		}
+
+		void removeFree(BlockHeader* block)
+		{
+			int fl;
+			int sl;
+			mappingInsert(block->getSize(), fl, sl);
+			removeFreeAt(block, fl, sl);
+		}
+
+		void removeFreeAt(BlockHeader* block, int fl, int sl)
+		{
+			if (block->prevFree)
+			{
+				block->prevFree->nextFree = block->nextFree;
+			}
+			else
+			{
+				freeLists[fl][sl] = block->nextFree;
+				if (!block->nextFree)
+				{
+					slBitmap[fl] &= ~(1u << sl);
+					if (!slBitmap[fl])
+					{
+						flBitmap &= ~(1u << fl);
+					}
+				}
+			}
+			if (block->nextFree)
+			{
+				block->nextFree->prevFree = block->prevFree;
+			}
+		}
+
+		/**
+		 * @brief Parte el bloque si sobra espacio para otro y devuelve la cola libre a su lista.
+		 */
+		BlockHeader* splitTail(BlockHeader* block, size_t size)
+		{
+			if (block->getSize() < size + HeaderSize + MinBlockSize)
+			{
+				return nullptr;
+			}
+			BlockHeader* remaining = reinterpret_cast<BlockHeader*>(static_cast<unsigned char*>(toPtr(block)) + size);
+			remaining->sizeAndFlags = 0;
+			remaining->setSize(block->getSize() - size - HeaderSize);
+			remaining->setFree(true);
+			remaining->prevPhys = block;
+			nextPhys(remaining)->prevPhys = remaining;
+			block->setSize(size);
+			return remaining;
+		}
+
+		void* prepareUsed(BlockHeader* block, size_t size)
+		{
+			BlockHeader* remaining = splitTail(block, size);
+			if (remaining)
+			{
+				freeBytes += remaining->getSize();
+				insertFree(remaining);
+			}
+			block->setFree(false);
+			usedBytes += block->getSize();
+			return toPtr(block);
+		}
+
+		void trimUsed(BlockHeader* block, size_t size)
+		{
+			BlockHeader* remaining = splitTail(block, size);
+			if (remaining)
+			{
+				usedBytes -= remaining->getSize() + HeaderSize;
+				freeBytes += remaining->getSize();
+				remaining = mergeNext(remaining);
+				insertFree(remaining);
+			}
+		}
+
+		BlockHeader* trimFreeLeading(BlockHeader* block, size_t gap)
+		{
+			// El hueco inicial se queda en block como bloque libre; el resto empieza en la dirección alineada
+			BlockHeader* remaining = reinterpret_cast<BlockHeader*>(static_cast<unsigned char*>(toPtr(block)) + gap - HeaderSize);
+			remaining->sizeAndFlags = 0;
+			remaining->setSize(block->getSize() - gap);
+			remaining->setFree(true);
+			remaining->prevPhys = block;
+			nextPhys(remaining)->prevPhys = remaining;
+			block->setSize(gap - HeaderSize);
+			freeBytes += block->getSize();
+			insertFree(block);
+			return remaining;
+		}
+
+		BlockHeader* mergePrev(BlockHeader* block)
+		{
+			BlockHeader* prev = block->prevPhys;
+			if (prev && prev->isFree())
+			{
+				removeFree(prev);
+				prev->setSize(prev->getSize() + HeaderSize + block->getSize());
+				nextPhys(prev)->prevPhys = prev;
+				freeBytes += HeaderSize;
+				return prev;
+			}
+			return block;
+		}
+
+		BlockHeader* mergeNext(BlockHeader* block)
+		{
+			BlockHeader* next = nextPhys(block);
+			if (next->isFree())
+			{
+				removeFree(next);
+				block->setSize(block->getSize() + HeaderSize + next->getSize());
+				nextPhys(block)->prevPhys = block;
+				freeBytes += HeaderSize;
+			}
+			return block;
+		}
+
+		void clearLists()
+		{
+			flBitmap = 0;
+			std::memset(slBitmap, 0, sizeof(slBitmap));
+			std::memset(freeLists, 0, sizeof(freeLists));
+			usedBytes = 0;
+			freeBytes = 0;
+			regions.clear();
+		}
+
+		void releaseRegions()
+		{
+			for (PageAllocation& region : ownedRegions)
+			{
+				FreePages(region);
+			}
+			ownedRegions.clear();
+		}
+
+		uint32_t flBitmap;                                  ///< Primer nivel: qué potencias tienen bloques.
+		uint32_t slBitmap[FLIndexCount];                    ///< Segundo nivel: qué tramos tienen bloques.
+		BlockHeader* freeLists[FLIndexCount][SLIndexCount]; ///< Listas de bloques libres.
+		size_t usedBytes;                                   ///< Bytes entregados.
+		size_t freeBytes;                                   ///< Bytes libres en bloques.
+		std::vector<PageAllocation> ownedRegions;           ///< Regiones que libera el destructor.
+		std::vector<BlockHeader*> regions;                  ///< Primer bloque físico de cada región.
+	};
+
+	/**
+	 * @brief std::vector cuya memoria vive en un TTLSFHeap.
+	 */
+	template<typename T>
+	using TTLSFVector = std::vector<T, TArenaAllocator<T, TTLSFHeap>>;
+
+	// EXAMPLE
+
+	/*
+	// Benchmark de latencia y fragmentación frente a malloc con tamaños aleatorios (16 B - 64 KB)
+	#include <algorithm>
+	#include <chrono>
+	#include <random>
+
+	template<typename AllocFn, typename FreeFn>
+	void Churn(const char* Name, AllocFn Alloc, FreeFn Free)
+	{
+		std::mt19937 Rng(1234);
+		std::uniform_int_distribution<size_t> SizeDist(16, 64 * 1024);
+		std::vector<void*> Live(4096, nullptr);
+		std::vector<double> Latencies;
+		Latencies.reserve(1000000);
+
+		for (int i = 0; i < 1000000; ++i)
+		{
+			size_t Slot = Rng() % Live.size();
+			auto Start = std::chrono::high_resolution_clock::now();
+			if (Live[Slot])
+			{
+				Free(Live[Slot]);
+				Live[Slot] = nullptr;
+			}
+			else
+			{
+				Live[Slot] = Alloc(SizeDist(Rng));
+			}
+			auto End = std::chrono::high_resolution_clock::now();
+			Latencies.push_back(std::chrono::duration<double, std::nano>(End - Start).count());
+		}
+
+		std::sort(Latencies.begin(), Latencies.end());
+		std::cout << Name
+			<< " p50: " << Latencies[Latencies.size() / 2] << " ns"
+			<< " p99.9: " << Latencies[Latencies.size() * 999 / 1000] << " ns"
+			<< " max: " << Latencies.back() << " ns" << std::endl;
+
+		for (void* Ptr : Live)
+			if (Ptr)
+				Free(Ptr);
+	}
+
+	int main()
+	{
+		EU::TTLSFHeap Heap(512ull * 1024 * 1024);
+
+		Churn("TLSF  ", [&](size_t Size) { return Heap.allocate(Size); }, [&](void* Ptr) { Heap.deallocate(Ptr); });
+		Churn("malloc", [](size_t Size) { return std::malloc(Size); }, [](void* Ptr) { std::free(Ptr); });
+
+		// Fragmentación externa: 1 - mayor bloque libre / memoria libre total
+		std::cout << "TLSF fragmentation: "
+			<< 1.0 - double(Heap.getLargestFreeBlock()) / double(Heap.getFree()) << std::endl;
+
+		// Agotamiento: allocate() devuelve nullptr, pero un contenedor recibe std::bad_alloc
+		EU::TTLSFHeap Small(4 * 1024);
+		EU::TTLSFVector<int> Values{ EU::TArenaAllocator<int, EU::TTLSFHeap>(Small) };
+		try
+		{
+			for (int i = 0; i < 4096; ++i)
+				Values.push_back(i);
+		}
+		catch (const std::bad_alloc&)
+		{
+			std::cout << "TLSF heap exhausted at " << Values.size() << " elements" << std::endl;
+		}
+
+		return 0;
+	}
+	*/
+}
\ No newline at end of file
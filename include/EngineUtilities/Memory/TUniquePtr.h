@@ -0,0 +1,426 @@
+﻿/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace EU {
+	/**
+	 * @brief Deleter por defecto de TUniquePtr: llama a delete.
+	 *
+	 * No tiene estado, así que gracias a la optimización de base vacía no ocupa espacio
+	 * dentro de TUniquePtr.
+	 */
+	template<typename T>
+	struct TDefaultDelete
+	{
+		TDefaultDelete() = default;
+
+		/**
+		 * @brief Conversión desde el deleter de un tipo derivado.
+		 */
+		template<typename U, typename = std::enable_if_t<std::is_convertible<U*, T*>::value>>
+		TDefaultDelete(const TDefaultDelete<U>&) {}
+
+		void operator()(T* ptr) const
+		{
+			static_assert(sizeof(T) > 0, "Cannot delete a pointer to an incomplete type");
+			delete ptr;
+		}
+	};
+
+	/**
+	 * @brief Deleter por defecto para arrays: llama a delete[].
+	 */
+	template<typename T>
+	struct TDefaultDelete<T[]>
+	{
+		TDefaultDelete() = default;
+
+		void operator()(T* ptr) const
+		{
+			static_assert(sizeof(T) > 0, "Cannot delete a pointer to an incomplete type");
+			delete[] ptr;
+		}
+	};
+
+	namespace Detail {
+		/**
+		 * @brief Par (deleter, puntero) que no ocupa espacio extra si el deleter es vacío.
+		 *
+		 * Cuando el deleter no tiene estado se hereda de él (optimización de base vacía) y el
+		 * par ocupa exactamente lo mismo que un puntero crudo.
+		 */
+		template<typename Deleter, typename Pointer,
+			bool UseEbo = std::is_empty<Deleter>::value && !std::is_final<Deleter>::value>
+		class TCompressedPair : private Deleter
+		{
+		public:
+			TCompressedPair() : Deleter(), ptr(nullptr) {}
+
+			template<typename D>
+			TCompressedPair(D&& deleter, Pointer p) : Deleter(std::forward<D>(deleter)), ptr(p) {}
+
+			Deleter& getDeleter() { return *this; }
+			const Deleter& getDeleter() const { return *this; }
+
+			Pointer ptr;
+		};
+
+		template<typename Deleter, typename Pointer>
+		class TCompressedPair<Deleter, Pointer, false>
+		{
+		public:
+			TCompressedPair() : deleter(), ptr(nullptr) {}
+
+			template<typename D>
+			TCompressedPair(D&& inDeleter, Pointer p) : deleter(std::forward<D>(inDeleter)), ptr(p) {}
+
+			Deleter& getDeleter() { return deleter; }
+			const Deleter& getDeleter() const { return deleter; }
+
+			Deleter deleter;
+			Pointer ptr;
+		};
+	}
+
+	/**
+	 * @brief Clase TUniquePtr para manejar un objeto con un único propietario.
+	 *
+	 * TUniquePtr destruye el objeto gestionado cuando sale de su ámbito. No se puede copiar,
+	 * solo mover, por lo que no necesita recuento de referencias: con el deleter por defecto
+	 * ocupa lo mismo que un puntero crudo y no hace ninguna reserva adicional. Es la opción
+	 * para recursos con un solo dueño, como los componentes de un actor; TSharedPointer queda
+	 * para objetos realmente compartidos.
+	 *
+	 * @tparam T Tipo del objeto gestionado.
+	 * @tparam Deleter Functor que libera el objeto (por defecto TDefaultDelete<T>).
+	 */
+	template<typename T, typename Deleter = TDefaultDelete<T>>
+	class TUniquePtr
+	{
+	public:
+		/**
+		 * @brief Constructor por defecto: puntero nulo.
+		 */
+		TUniquePtr() : pair() {}
+
+		/**
+		 * @brief Constructor desde nullptr.
+		 */
+		TUniquePtr(std::nullptr_t) : pair() {}
+
+		/**
+		 * @brief Toma la propiedad de un puntero crudo.
+		 *
+		 * @param rawPtr Puntero al objeto que se va a gestionar.
+		 */
+		explicit TUniquePtr(T* rawPtr) : pair(Deleter(), rawPtr) {}
+
+		/**
+		 * @brief Toma la propiedad de un puntero crudo con un deleter concreto.
+		 *
+		 * @param rawPtr Puntero al objeto que se va a gestionar.
+		 * @param deleter Functor que liberará el objeto.
+		 */
+		TUniquePtr(T* rawPtr, const Deleter& deleter) : pair(deleter, rawPtr) {}
+
+		/**
+		 * @brief Constructor de movimiento: transfiere la propiedad.
+		 */
+		TUniquePtr(TUniquePtr&& other) noexcept : pair(std::move(other.getDeleter()), other.release()) {}
+
+		/**
+		 * @brief Constructor de movimiento desde un tipo derivado.
+		 */
+		template<typename U, typename E,
+			typename = std::enable_if_t<std::is_convertible<U*, T*>::value && std::is_convertible<E, Deleter>::value>>
+		TUniquePtr(TUniquePtr<U, E>&& other) noexcept : pair(std::move(other.getDeleter()), other.release()) {}
+
+		TUniquePtr(const TUniquePtr&) = delete;
+		TUniquePtr& operator=(const TUniquePtr&) = delete;
+
+		/**
+		 * @brief Asignación de movimiento: libera el objeto actual y toma el del otro.
+		 */
+		TUniquePtr& operator=(TUniquePtr&& other) noexcept
+		{
+			if (this != &other)
+			{
+				reset(other.release());
+				getDeleter() = std::move(other.getDeleter());
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Asignación de movimiento desde un tipo derivado.
+		 */
+		template<typename U, typename E,
+			typename = std::enable_if_t<std::is_convertible<U*, T*>::value && std::is_convertible<E, Deleter>::value>>
+		TUniquePtr& operator=(TUniquePtr<U, E>&& other) noexcept
+		{
+			reset(other.release());
+			getDeleter() = std::move(other.getDeleter());
+			return *this;
+		}
+
+		/**
+		 * @brief Asignación de nullptr: libera el objeto.
+		 */
+		TUniquePtr& operator=(std::nullptr_t) noexcept
+		{
+			reset();
+			return *this;
+		}
+
+		/**
+		 * @brief Destructor: libera el objeto gestionado si existe.
+		 */
+		~TUniquePtr()
+		{
+			if (pair.ptr)
+			{
+				pair.getDeleter()(pair.ptr);
+			}
+		}
+
+		T& operator*() const { return *pair.ptr; }
+		T* operator->() const { return pair.ptr; }
+
+		explicit operator bool() const { return pair.ptr != nullptr; }
+
+		/**
+		 * @brief Obtener el puntero crudo sin ceder la propiedad.
+		 */
+		T* get() const { return pair.ptr; }
+
+		/**
+		 * @brief Comprobar si el puntero es nulo.
+		 */
+		bool isNull() const { return pair.ptr == nullptr; }
+
+		Deleter& getDeleter() { return pair.getDeleter(); }
+		const Deleter& getDeleter() const { return pair.getDeleter(); }
+
+		/**
+		 * @brief Cede la propiedad: devuelve el puntero y deja este TUniquePtr nulo.
+		 *
+		 * @return Puntero que ahora debe liberar el llamador.
+		 */
+		T* release()
+		{
+			T* old = pair.ptr;
+			pair.ptr = nullptr;
+			return old;
+		}
+
+		/**
+		 * @brief Libera el objeto actual y opcionalmente gestiona uno nuevo.
+		 *
+		 * @param newPtr Nuevo puntero a gestionar (por defecto nullptr).
+		 */
+		void reset(T* newPtr = nullptr)
+		{
+			T* old = pair.ptr;
+			pair.ptr = newPtr;
+			if (old)
+			{
+				pair.getDeleter()(old);
+			}
+		}
+
+		/**
+		 * @brief Intercambia el contenido con otro TUniquePtr.
+		 */
+		void swap(TUniquePtr& other) noexcept
+		{
+			std::swap(pair.ptr, other.pair.ptr);
+			std::swap(pair.getDeleter(), other.pair.getDeleter());
+		}
+
+	private:
+		Detail::TCompressedPair<Deleter, T*> pair; ///< Deleter (vacío con EBO) y puntero gestionado.
+	};
+
+	/**
+	 * @brief Especialización de TUniquePtr para arrays reservados con new[].
+	 *
+	 * Ofrece operator[] en lugar de -> y libera con delete[].
+	 */
+	template<typename T, typename Deleter>
+	class TUniquePtr<T[], Deleter>
+	{
+	public:
+		TUniquePtr() : pair() {}
+		TUniquePtr(std::nullptr_t) : pair() {}
+
+		/**
+		 * @brief Toma la propiedad de un array reservado con new[].
+		 */
+		explicit TUniquePtr(T* rawPtr) : pair(Deleter(), rawPtr) {}
+
+		TUniquePtr(T* rawPtr, const Deleter& deleter) : pair(deleter, rawPtr) {}
+
+		TUniquePtr(TUniquePtr&& other) noexcept : pair(std::move(other.getDeleter()), other.release()) {}
+
+		TUniquePtr(const TUniquePtr&) = delete;
+		TUniquePtr& operator=(const TUniquePtr&) = delete;
+
+		TUniquePtr& operator=(TUniquePtr&& other) noexcept
+		{
+			if (this != &other)
+			{
+				reset(other.release());
+				getDeleter() = std::move(other.getDeleter());
+			}
+			return *this;
+		}
+
+		TUniquePtr& operator=(std::nullptr_t) noexcept
+		{
+			reset();
+			return *this;
+		}
+
+		~TUniquePtr()
+		{
+			if (pair.ptr)
+			{
+				pair.getDeleter()(pair.ptr);
+			}
+		}
+
+		/**
+		 * @brief Acceso a un elemento del array.
+		 */
+		T& operator[](size_t index) const { return pair.ptr[index]; }
+
+		explicit operator bool() const { return pair.ptr != nullptr; }
+
+		T* get() const { return pair.ptr; }
+		bool isNull() const { return pair.ptr == nullptr; }
+
+		Deleter& getDeleter() { return pair.getDeleter(); }
+		const Deleter& getDeleter() const { return pair.getDeleter(); }
+
+		T* release()
+		{
+			T* old = pair.ptr;
+			pair.ptr = nullptr;
+			return old;
+		}
+
+		void reset(T* newPtr = nullptr)
+		{
+			T* old = pair.ptr;
+			pair.ptr = newPtr;
+			if (old)
+			{
+				pair.getDeleter()(old);
+			}
+		}
+
+		void swap(TUniquePtr& other) noexcept
+		{
+			std::swap(pair.ptr, other.pair.ptr);
+			std::swap(pair.getDeleter(), other.pair.getDeleter());
+		}
+
+	private:
+		Detail::TCompressedPair<Deleter, T*> pair; ///< Deleter (vacío con EBO) y puntero al array.
+	};
+
+	template<typename T, typename D>
+	bool operator==(const TUniquePtr<T, D>& ptr, std::nullptr_t) { return ptr.isNull(); }
+
+	template<typename T, typename D>
+	bool operator!=(const TUniquePtr<T, D>& ptr, std::nullptr_t) { return !ptr.isNull(); }
+
+	/**
+	 * @brief Función de utilidad para crear un TUniquePtr.
+	 *
+	 * @tparam T Tipo del objeto gestionado.
+	 * @param args Argumentos reenviados al constructor de T.
+	 * @return Un TUniquePtr que gestiona un nuevo objeto de tipo T.
+	 */
+	template<typename T, typename... Args>
+	std::enable_if_t<!std::is_array<T>::value, TUniquePtr<T>>
+	MakeUnique(Args&&... args)
+	{
+		return TUniquePtr<T>(new T(std::forward<Args>(args)...));
+	}
+
+	/**
+	 * @brief Crea un TUniquePtr a un array de tamaño dinámico con sus elementos inicializados por valor.
+	 *
+	 * @param size Número de elementos.
+	 */
+	template<typename T>
+	std::enable_if_t<std::is_array<T>::value && std::extent<T>::value == 0, TUniquePtr<T>>
+	MakeUnique(size_t size)
+	{
+		using Element = std::remove_extent_t<T>;
+		return TUniquePtr<T>(new Element[size]());
+	}
+
+	/**
+	 * @brief Los arrays de tamaño fijo (T[N]) no se admiten; usar T[] o un TArray.
+	 */
+	template<typename T, typename... Args>
+	std::enable_if_t<(std::extent<T>::value != 0)> MakeUnique(Args&&...) = delete;
+
+	static_assert(sizeof(TUniquePtr<int>) == sizeof(int*), "TUniquePtr with the default deleter must be pointer-sized");
+	static_assert(sizeof(TUniquePtr<int[]>) == sizeof(int*), "TUniquePtr<T[]> with the default deleter must be pointer-sized");
+
+	// EXAMPLE
+
+	/*
+	struct Node
+	{
+		Node(int InValue) : Value(InValue) {}
+		int Value;
+	};
+
+	int main()
+	{
+		EU::TUniquePtr<Node> A = EU::MakeUnique<Node>(42);
+		EU::TUniquePtr<Node> B = std::move(A);            // A queda nulo, sin recuento de referencias
+
+		std::cout << A.isNull() << " " << B->Value << std::endl;   // 1 42
+		std::cout << sizeof(B) << std::endl;                        // sizeof(Node*)
+
+		EU::TUniquePtr<float[]> Samples = EU::MakeUnique<float[]>(256);
+		Samples[0] = 1.0f;
+
+		return 0;
+	}
+	*/
+}
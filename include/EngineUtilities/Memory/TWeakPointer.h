@@ -38,9 +38,11 @@ namespace
 		 * sin tener influencia sobre el recuento de referencias del objeto. Permite acceder al objeto solo si
 		 * aún existe.
 		 */
-	template<typename T>
+	template<typename T, ESPMode Mode = ESPMode::NotThreadSafe>
 	class TWeakPointer {
 	public:
+		using ControlBlock = Detail::TSharedControlBlock<Mode>;
+
 		/**
 		 * @brief Constructor por defecto.
 		 */
@@ -49,32 +51,120 @@ namespace
 		/**
 		 * @brief Constructor que toma un TSharedPointer.
 		 *
+		 * Incrementa el recuento débil, que mantiene vivo el bloque de control (no el objeto).
+		 *
 		 * @param sharedPtr TSharedPointer desde el cual se observará el objeto.
 		 */
-		TWeakPointer(const TSharedPointer<T>& sharedPtr)
+		TWeakPointer(const TSharedPointer<T, Mode>& sharedPtr)
 			: ptr(sharedPtr.ptr), refCount(sharedPtr.refCount) {
+			if (refCount) {
+				refCount->addWeakRef();
+			}
+		}
+
+		/**
+		 * @brief Constructor de copia.
+		 */
+		TWeakPointer(const TWeakPointer& other) : ptr(other.ptr), refCount(other.refCount) {
+			if (refCount) {
+				refCount->addWeakRef();
+			}
+		}
+
+		/**
+		 * @brief Constructor de movimiento.
+		 */
+		TWeakPointer(TWeakPointer&& other) noexcept : ptr(other.ptr), refCount(other.refCount) {
+			other.ptr = nullptr;
+			other.refCount = nullptr;
+		}
+
+		/**
+		 * @brief Operador de asignación de copia.
+		 */
+		TWeakPointer&
+			operator=(const TWeakPointer& other) {
+			if (this != &other) {
+				if (other.refCount) {
+					other.refCount->addWeakRef();
+				}
+				if (refCount) {
+					refCount->releaseWeak();
+				}
+				ptr = other.ptr;
+				refCount = other.refCount;
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Operador de asignación de movimiento.
+		 */
+		TWeakPointer&
+			operator=(TWeakPointer&& other) noexcept {
+			if (this != &other) {
+				if (refCount) {
+					refCount->releaseWeak();
+				}
+				ptr = other.ptr;
+				refCount = other.refCount;
+				other.ptr = nullptr;
+				other.refCount = nullptr;
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Destructor: suelta la referencia débil.
+		 */
+		~TWeakPointer() {
+			if (refCount) {
+				refCount->releaseWeak();
+			}
 		}
 
 		/**
 		 * @brief Convertir TWeakPointer a TSharedPointer.
 		 *
+		 * No toma locks: con ESPMode::ThreadSafe el recuento fuerte se incrementa con una
+		 * comparación atómica solo si todavía no ha llegado a cero, así que es seguro aunque
+		 * otro hilo suelte la última referencia al mismo tiempo.
+		 *
 		 * @return Un TSharedPointer al objeto gestionado, o nullptr si el objeto ha sido destruido.
 		 */
-		TSharedPointer<T>
+		TSharedPointer<T, Mode>
 			lock() const {
-			if (refCount && *refCount > 0) {
-				return TSharedPointer<T>(ptr, refCount);
+			TSharedPointer<T, Mode> result;
+			if (refCount && refCount->tryAddRef()) {
+				result.ptr = ptr;
+				result.refCount = refCount;
 			}
-			return TSharedPointer<T>();
+			return result;
+		}
+
+		/**
+		 * @brief Indica si el objeto observado ya fue destruido.
+		 */
+		bool
+			expired() const {
+			return !refCount || refCount->getRefCount() == 0;
 		}
 
-		// Hacer que TSharedPointer sea un amigo para acceder a los miembros privados.
-		template<typename U>
-		friend class TSharedPointer;
+		/**
+		 * @brief Deja de observar el objeto.
+		 */
+		void
+			reset() {
+			if (refCount) {
+				refCount->releaseWeak();
+			}
+			ptr = nullptr;
+			refCount = nullptr;
+		}
 
 	private:
 		T* ptr;       ///< Puntero al objeto observado.
-		int* refCount; ///< Puntero al recuento de referencias del TSharedPointer original.
+		ControlBlock* refCount; ///< Bloque de control del TSharedPointer original.
 	};
 
 	/*
@@ -28,6 +28,9 @@
 */
 
 #pragma once
+#include <cstdlib>
+#include <iostream>
+
 namespace EU {
 	/**
 	 * @brief TArray es una clase de array dinámica para almacenar elementos de tipo T.
@@ -160,6 +163,28 @@ namespace EU {
 		{
 			return Capacity;  ///< Devolver la capacidad actual del array.
 		}
+
+		/**
+		 * @brief Devuelve un puntero al primer elemento del array.
+		 *
+		 * Permite usar el array con algoritmos que trabajan sobre rangos contiguos.
+		 *
+		 * @return Puntero a los elementos, o nullptr si el array nunca reservó memoria.
+		 */
+		T* GetData()
+		{
+			return Data;
+		}
+
+		/**
+		 * @brief Versión constante de GetData.
+		 *
+		 * @return Puntero constante a los elementos.
+		 */
+		const T* GetData() const
+		{
+			return Data;
+		}
 	};
 
 	// EXAMPLE
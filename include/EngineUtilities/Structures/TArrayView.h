@@ -0,0 +1,220 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+#include "EngineUtilities/Structures/TArray.h"
+
+namespace EU {
+	/**
+	 * @brief Vista no propietaria sobre un rango contiguo de elementos de tipo T.
+	 *
+	 * TArrayView guarda solo un puntero y un número de elementos: copiarla no copia los datos ni
+	 * reserva memoria. Sirve para que las funciones acepten arrays de C, std::vector o TArray sin
+	 * forzar al llamador a construir un contenedor temporal. Con T = const U la vista es de solo
+	 * lectura. La vista no prolonga la vida de los datos: el contenedor original debe seguir
+	 * vivo mientras se use.
+	 *
+	 * @tparam T Tipo de los elementos (const T para vistas de solo lectura).
+	 */
+	template<typename T>
+	class TArrayView
+	{
+	public:
+		using ElementType = T;
+		using ValueType = std::remove_cv_t<T>;
+
+		/**
+		 * @brief Constructor por defecto: vista vacía.
+		 */
+		TArrayView() : Data(nullptr), Size(0) {}
+
+		/**
+		 * @brief Construye una vista desde un puntero y un número de elementos.
+		 *
+		 * @param InData Puntero al primer elemento.
+		 * @param InSize Número de elementos.
+		 */
+		TArrayView(T* InData, size_t InSize) : Data(InData), Size(InSize) {}
+
+		/**
+		 * @brief Construye una vista desde un rango [First, Last).
+		 */
+		TArrayView(T* First, T* Last) : Data(First), Size(static_cast<size_t>(Last - First)) {}
+
+		/**
+		 * @brief Construye una vista sobre un array de C.
+		 */
+		template<size_t N>
+		TArrayView(T (&Array)[N]) : Data(Array), Size(N) {}
+
+		/**
+		 * @brief Construye una vista sobre un std::vector.
+		 */
+		template<typename Alloc>
+		TArrayView(std::vector<ValueType, Alloc>& Vector) : Data(Vector.data()), Size(Vector.size()) {}
+
+		/**
+		 * @brief Construye una vista de solo lectura sobre un std::vector constante.
+		 */
+		template<typename Alloc, typename U = T, typename = std::enable_if_t<std::is_const<U>::value>>
+		TArrayView(const std::vector<ValueType, Alloc>& Vector) : Data(Vector.data()), Size(Vector.size()) {}
+
+		/**
+		 * @brief Construye una vista sobre un TArray.
+		 */
+		TArrayView(TArray<ValueType>& Array) : Data(Array.GetData()), Size(Array.Num()) {}
+
+		/**
+		 * @brief Construye una vista de solo lectura sobre un TArray constante.
+		 */
+		template<typename U = T, typename = std::enable_if_t<std::is_const<U>::value>>
+		TArrayView(const TArray<ValueType>& Array) : Data(Array.GetData()), Size(Array.Num()) {}
+
+		/**
+		 * @brief Conversión implícita de TArrayView<U> a TArrayView<const U>.
+		 */
+		template<typename U, typename = std::enable_if_t<std::is_same<const U, T>::value && !std::is_same<U, T>::value>>
+		TArrayView(const TArrayView<U>& Other) : Data(Other.GetData()), Size(Other.Num()) {}
+
+		/**
+		 * @brief Accede a un elemento. En Debug se comprueba el rango.
+		 */
+		T& operator[](size_t Index) const
+		{
+			assert(Index < Size && "TArrayView index out of range");
+			return Data[Index];
+		}
+
+		/**
+		 * @brief Puntero al primer elemento de la vista.
+		 */
+		T* GetData() const { return Data; }
+
+		/**
+		 * @brief Número de elementos de la vista.
+		 */
+		size_t Num() const { return Size; }
+
+		/**
+		 * @brief Tamaño de la vista en bytes.
+		 */
+		size_t NumBytes() const { return Size * sizeof(T); }
+
+		/**
+		 * @brief Indica si la vista no contiene elementos.
+		 */
+		bool IsEmpty() const { return Size == 0; }
+
+		/**
+		 * @brief Primer elemento. La vista no debe estar vacía.
+		 */
+		T& Front() const { return (*this)[0]; }
+
+		/**
+		 * @brief Último elemento. La vista no debe estar vacía.
+		 */
+		T& Back() const { return (*this)[Size - 1]; }
+
+		/**
+		 * @brief Sub-vista de Count elementos empezando en Offset.
+		 */
+		TArrayView Slice(size_t Offset, size_t Count) const
+		{
+			assert(Offset + Count <= Size && "TArrayView slice out of range");
+			return TArrayView(Data + Offset, Count);
+		}
+
+		/**
+		 * @brief Sub-vista con los primeros Count elementos.
+		 */
+		TArrayView Left(size_t Count) const { return Slice(0, Count); }
+
+		/**
+		 * @brief Sub-vista con los últimos Count elementos.
+		 */
+		TArrayView Right(size_t Count) const { return Slice(Size - Count, Count); }
+
+		/**
+		 * @brief Copia los elementos de la vista a un std::vector nuevo.
+		 *
+		 * Es la única operación de la vista que reserva memoria; usarla solo cuando el destino
+		 * realmente necesite su propia copia.
+		 */
+		std::vector<ValueType> ToVector() const { return std::vector<ValueType>(Data, Data + Size); }
+
+		// Soporte para bucles for basados en rango y algoritmos de la STL
+		T* begin() const { return Data; }
+		T* end() const { return Data + Size; }
+		T* data() const { return Data; }
+		size_t size() const { return Size; }
+		bool empty() const { return Size == 0; }
+
+	private:
+		T* Data;      ///< Puntero al primer elemento (no propietario).
+		size_t Size;  ///< Número de elementos visibles.
+	};
+
+	/**
+	 * @brief Alias de TArrayView con la nomenclatura de std::span.
+	 */
+	template<typename T>
+	using TSpan = TArrayView<T>;
+
+	/**
+	 * @brief Crea una vista desde un puntero y un número de elementos, deduciendo el tipo.
+	 */
+	template<typename T>
+	TArrayView<T> MakeArrayView(T* Data, size_t Size)
+	{
+		return TArrayView<T>(Data, Size);
+	}
+
+	/**
+	 * @brief Crea una vista sobre un std::vector, deduciendo el tipo.
+	 */
+	template<typename T, typename Alloc>
+	TArrayView<T> MakeArrayView(std::vector<T, Alloc>& Vector)
+	{
+		return TArrayView<T>(Vector);
+	}
+
+	/**
+	 * @brief Crea una vista de solo lectura sobre un std::vector constante.
+	 */
+	template<typename T, typename Alloc>
+	TArrayView<const T> MakeArrayView(const std::vector<T, Alloc>& Vector)
+	{
+		return TArrayView<const T>(Vector);
+	}
+
+	// EXAMPLE
+
+	/*
+	float Sum(EU::TArrayView<const float> Values)
+	{
+		float Total = 0.0f;
+		for (float Value : Values)
+		{
+			Total += Value;
+		}
+		return Total;
+	}
+
+	int main()
+	{
+		float Raw[] = { 1.0f, 2.0f, 3.0f };
+		std::vector<float> Vector = { 4.0f, 5.0f };
+		EU::TArray<float> Array;
+		Array.Add(6.0f);
+
+		// Ninguna de estas llamadas copia los datos
+		std::cout << Sum(Raw) << std::endl;               // 6
+		std::cout << Sum(Vector) << std::endl;            // 9
+		std::cout << Sum(Array) << std::endl;             // 6
+		std::cout << Sum(EU::TArrayView<const float>(Raw).Slice(1, 2)) << std::endl;  // 5
+
+		return 0;
+	}
+	*/
+}
@@ -27,10 +27,9 @@
  * SOFTWARE.
 */
 #pragma once
+#include <iostream>
 
 namespace EU {
-#pragma once
-#include <iostream>
 
 	/**
 	 * @brief Clase TPair para representar un par de valores.
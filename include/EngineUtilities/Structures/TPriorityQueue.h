@@ -0,0 +1,644 @@
+﻿/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace EU {
+	namespace Detail {
+		/**
+		 * @brief Nodo del heap: prioridad y el identificador del elemento al que pertenece.
+		 *
+		 * El nodo es pequeño (prioridad + 32 bits) para que un grupo de hijos de un heap 4-ario
+		 * quepa en una sola línea de caché; la carga útil vive fuera del heap.
+		 */
+		template<typename P>
+		struct THeapNode
+		{
+			P Priority;
+			uint32_t Id;
+		};
+
+		/**
+		 * @brief Núcleo de un heap d-ario con seguimiento de posiciones.
+		 *
+		 * Positions[Id] guarda el índice del nodo en el heap, lo que permite actualizar o eliminar
+		 * un elemento arbitrario en O(log_d n). El comparador define qué elemento sale primero:
+		 * con std::less, el de menor prioridad (min-heap).
+		 */
+		template<typename P, typename Compare, uint32_t Arity>
+		struct TDaryHeap
+		{
+			static_assert(Arity >= 2, "Arity must be at least 2");
+
+			std::vector<THeapNode<P>> Nodes;  ///< Nodos en orden de heap.
+			std::vector<uint32_t> Positions;  ///< Posición de cada Id dentro de Nodes.
+			Compare Comp;
+
+			static constexpr uint32_t InvalidPosition = 0xFFFFFFFFu;
+
+			void Place(size_t Index, const THeapNode<P>& Node)
+			{
+				Nodes[Index] = Node;
+				Positions[Node.Id] = static_cast<uint32_t>(Index);
+			}
+
+			void SiftUp(size_t Index)
+			{
+				THeapNode<P> Node = Nodes[Index];
+				while (Index > 0)
+				{
+					const size_t Parent = (Index - 1) / Arity;
+					if (!Comp(Node.Priority, Nodes[Parent].Priority))
+					{
+						break;
+					}
+					Place(Index, Nodes[Parent]);
+					Index = Parent;
+				}
+				Place(Index, Node);
+			}
+
+			void SiftDown(size_t Index)
+			{
+				const size_t Count = Nodes.size();
+				THeapNode<P> Node = Nodes[Index];
+				for (;;)
+				{
+					const size_t First = Index * Arity + 1;
+					if (First >= Count)
+					{
+						break;
+					}
+					const size_t Last = (First + Arity < Count) ? First + Arity : Count;
+					size_t Best = First;
+					for (size_t Child = First + 1; Child < Last; ++Child)
+					{
+						if (Comp(Nodes[Child].Priority, Nodes[Best].Priority))
+						{
+							Best = Child;
+						}
+					}
+					if (!Comp(Nodes[Best].Priority, Node.Priority))
+					{
+						break;
+					}
+					Place(Index, Nodes[Best]);
+					Index = Best;
+				}
+				Place(Index, Node);
+			}
+
+			/**
+			 * @brief Restaura la propiedad de heap tras cambiar la prioridad del nodo en Index.
+			 */
+			void Fix(size_t Index)
+			{
+				if (Index > 0 && Comp(Nodes[Index].Priority, Nodes[(Index - 1) / Arity].Priority))
+				{
+					SiftUp(Index);
+				}
+				else
+				{
+					SiftDown(Index);
+				}
+			}
+
+			void Insert(uint32_t Id, const P& Priority)
+			{
+				Nodes.push_back(THeapNode<P>{ Priority, Id });
+				SiftUp(Nodes.size() - 1);
+			}
+
+			/**
+			 * @brief Elimina el nodo en Index y devuelve el Id que contenía.
+			 */
+			uint32_t EraseAt(size_t Index)
+			{
+				const uint32_t Id = Nodes[Index].Id;
+				Positions[Id] = InvalidPosition;
+				const size_t LastIndex = Nodes.size() - 1;
+				if (Index != LastIndex)
+				{
+					Place(Index, Nodes[LastIndex]);
+					Nodes.pop_back();
+					Fix(Index);
+				}
+				else
+				{
+					Nodes.pop_back();
+				}
+				return Id;
+			}
+
+			/**
+			 * @brief Construye el heap en O(n) (Floyd) a partir de nodos en cualquier orden.
+			 */
+			void Heapify()
+			{
+				for (size_t i = 0; i < Nodes.size(); ++i)
+				{
+					Positions[Nodes[i].Id] = static_cast<uint32_t>(i);
+				}
+				if (Nodes.size() < 2)
+				{
+					return;
+				}
+				for (size_t i = (Nodes.size() - 2) / Arity + 1; i-- > 0;)
+				{
+					SiftDown(i);
+				}
+			}
+		};
+	}
+
+	/**
+	 * @brief Cola de prioridad basada en un heap 4-ario con soporte de decrease-key.
+	 *
+	 * Cada Push devuelve un Handle estable que permite cambiar la prioridad o retirar el elemento
+	 * sin reinsertarlo, algo que std::priority_queue no ofrece. El heap solo mueve pares
+	 * (prioridad, índice); los valores permanecen en un arreglo de ranuras reutilizables.
+	 * Pensada para priorizar peticiones de streaming por distancia a la cámara o trabajos por
+	 * fecha límite.
+	 *
+	 * @tparam T Tipo del valor almacenado.
+	 * @tparam P Tipo de la prioridad.
+	 * @tparam Compare Comparador de prioridades; std::less extrae primero la menor.
+	 * @tparam Arity Número de hijos por nodo del heap.
+	 */
+	template<typename T, typename P = float, typename Compare = std::less<P>, uint32_t Arity = 4>
+	class TPriorityQueue
+	{
+	public:
+		/**
+		 * @brief Identificador de un elemento encolado.
+		 *
+		 * La generación invalida los handles de elementos ya extraídos aunque su ranura se reutilice.
+		 */
+		struct Handle
+		{
+			uint32_t Index = 0xFFFFFFFFu;
+			uint32_t Generation = 0;
+
+			bool IsValid() const { return Index != 0xFFFFFFFFu; }
+			bool operator==(const Handle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+			bool operator!=(const Handle& Other) const { return !(*this == Other); }
+		};
+
+		TPriorityQueue() = default;
+
+		/**
+		 * @brief Reserva memoria para Count elementos.
+		 */
+		void Reserve(size_t Count)
+		{
+			Heap.Nodes.reserve(Count);
+			Heap.Positions.reserve(Count);
+			Values.reserve(Count);
+			Generations.reserve(Count);
+		}
+
+		/**
+		 * @brief Inserta un valor con la prioridad indicada.
+		 *
+		 * @return Handle para actualizar o retirar el elemento.
+		 */
+		Handle Push(const T& Value, const P& Priority)
+		{
+			const uint32_t Slot = AcquireSlot(Value);
+			Heap.Insert(Slot, Priority);
+			return Handle{ Slot, Generations[Slot] };
+		}
+
+		/**
+		 * @brief Inserta un valor por movimiento con la prioridad indicada.
+		 */
+		Handle Push(T&& Value, const P& Priority)
+		{
+			const uint32_t Slot = AcquireSlot(std::move(Value));
+			Heap.Insert(Slot, Priority);
+			return Handle{ Slot, Generations[Slot] };
+		}
+
+		/**
+		 * @brief Añade un elemento sin restaurar el heap. Llamar a Heapify() antes de consultar.
+		 *
+		 * Para cargas masivas es más barato que n llamadas a Push: O(n) en total frente a O(n log n).
+		 */
+		Handle PushUnordered(T Value, const P& Priority)
+		{
+			const uint32_t Slot = AcquireSlot(std::move(Value));
+			Heap.Nodes.push_back(Detail::THeapNode<P>{ Priority, Slot });
+			return Handle{ Slot, Generations[Slot] };
+		}
+
+		/**
+		 * @brief Restaura el heap tras una serie de PushUnordered.
+		 */
+		void Heapify()
+		{
+			Heap.Heapify();
+		}
+
+		/**
+		 * @brief Elemento con mayor prioridad según el comparador. La cola no debe estar vacía.
+		 */
+		const T& Top() const
+		{
+			return Values[Heap.Nodes[0].Id];
+		}
+
+		/**
+		 * @brief Prioridad del elemento en la cima. La cola no debe estar vacía.
+		 */
+		const P& TopPriority() const
+		{
+			return Heap.Nodes[0].Priority;
+		}
+
+		/**
+		 * @brief Handle del elemento en la cima. La cola no debe estar vacía.
+		 */
+		Handle TopHandle() const
+		{
+			const uint32_t Slot = Heap.Nodes[0].Id;
+			return Handle{ Slot, Generations[Slot] };
+		}
+
+		/**
+		 * @brief Extrae el elemento de la cima y lo devuelve por movimiento.
+		 */
+		T Pop()
+		{
+			const uint32_t Slot = Heap.EraseAt(0);
+			return ReleaseSlot(Slot);
+		}
+
+		/**
+		 * @brief Cambia la prioridad de un elemento encolado (sube o baja según corresponda).
+		 *
+		 * @return false si el handle ya no es válido.
+		 */
+		bool Update(Handle H, const P& NewPriority)
+		{
+			if (!Contains(H))
+			{
+				return false;
+			}
+			const uint32_t Position = Heap.Positions[H.Index];
+			Heap.Nodes[Position].Priority = NewPriority;
+			Heap.Fix(Position);
+			return true;
+		}
+
+		/**
+		 * @brief Mejora la prioridad de un elemento. Solo recorre el heap hacia arriba.
+		 *
+		 * @return false si el handle no es válido o la nueva prioridad no es mejor que la actual.
+		 */
+		bool DecreaseKey(Handle H, const P& NewPriority)
+		{
+			if (!Contains(H))
+			{
+				return false;
+			}
+			const uint32_t Position = Heap.Positions[H.Index];
+			if (Heap.Comp(Heap.Nodes[Position].Priority, NewPriority))
+			{
+				return false;
+			}
+			Heap.Nodes[Position].Priority = NewPriority;
+			Heap.SiftUp(Position);
+			return true;
+		}
+
+		/**
+		 * @brief Retira un elemento arbitrario de la cola.
+		 *
+		 * @return false si el handle ya no es válido.
+		 */
+		bool Remove(Handle H)
+		{
+			if (!Contains(H))
+			{
+				return false;
+			}
+			Heap.EraseAt(Heap.Positions[H.Index]);
+			ReleaseSlot(H.Index);
+			return true;
+		}
+
+		/**
+		 * @brief Indica si el handle sigue refiriéndose a un elemento encolado.
+		 */
+		bool Contains(Handle H) const
+		{
+			return H.Index < Generations.size()
+				&& Generations[H.Index] == H.Generation
+				&& Heap.Positions[H.Index] != Detail::TDaryHeap<P, Compare, Arity>::InvalidPosition;
+		}
+
+		/**
+		 * @brief Valor asociado a un handle válido.
+		 */
+		T& Get(Handle H) { return Values[H.Index]; }
+		const T& Get(Handle H) const { return Values[H.Index]; }
+
+		/**
+		 * @brief Prioridad actual de un handle válido.
+		 */
+		const P& GetPriority(Handle H) const
+		{
+			return Heap.Nodes[Heap.Positions[H.Index]].Priority;
+		}
+
+		/**
+		 * @brief Número de elementos encolados.
+		 */
+		size_t Num() const { return Heap.Nodes.size(); }
+
+		/**
+		 * @brief Indica si la cola está vacía.
+		 */
+		bool IsEmpty() const { return Heap.Nodes.empty(); }
+
+		/**
+		 * @brief Vacía la cola. Invalida todos los handles pero conserva la memoria reservada.
+		 */
+		void Clear()
+		{
+			for (const Detail::THeapNode<P>& Node : Heap.Nodes)
+			{
+				ReleaseSlot(Node.Id);
+			}
+			Heap.Nodes.clear();
+		}
+
+	private:
+		template<typename U>
+		uint32_t AcquireSlot(U&& Value)
+		{
+			if (!FreeSlots.empty())
+			{
+				const uint32_t Slot = FreeSlots.back();
+				FreeSlots.pop_back();
+				Values[Slot] = std::forward<U>(Value);
+				return Slot;
+			}
+			const uint32_t Slot = static_cast<uint32_t>(Values.size());
+			Values.push_back(std::forward<U>(Value));
+			Generations.push_back(0);
+			Heap.Positions.push_back(Detail::TDaryHeap<P, Compare, Arity>::InvalidPosition);
+			return Slot;
+		}
+
+		T ReleaseSlot(uint32_t Slot)
+		{
+			Heap.Positions[Slot] = Detail::TDaryHeap<P, Compare, Arity>::InvalidPosition;
+			++Generations[Slot];
+			FreeSlots.push_back(Slot);
+			return std::move(Values[Slot]);
+		}
+
+		Detail::TDaryHeap<P, Compare, Arity> Heap;  ///< Heap de (prioridad, ranura).
+		std::vector<T> Values;                      ///< Valores indexados por ranura.
+		std::vector<uint32_t> Generations;          ///< Generación de cada ranura.
+		std::vector<uint32_t> FreeSlots;            ///< Ranuras libres para reutilizar.
+	};
+
+	/**
+	 * @brief Cola de prioridad indexada por claves enteras densas.
+	 *
+	 * Variante sin carga útil: la clave (p. ej. el id de un asset o de un trabajo) es el propio
+	 * identificador, así que Update/Remove/Contains se resuelven con un acceso directo al arreglo
+	 * de posiciones. Las claves deben ser menores que la capacidad indicada en Resize.
+	 *
+	 * @tparam P Tipo de la prioridad.
+	 * @tparam Compare Comparador de prioridades; std::less extrae primero la menor.
+	 * @tparam Arity Número de hijos por nodo del heap.
+	 */
+	template<typename P = float, typename Compare = std::less<P>, uint32_t Arity = 4>
+	class TIndexedPriorityQueue
+	{
+	public:
+		TIndexedPriorityQueue() = default;
+
+		/**
+		 * @brief Crea la cola con espacio para claves en [0, KeyCapacity).
+		 */
+		explicit TIndexedPriorityQueue(uint32_t KeyCapacity)
+		{
+			Resize(KeyCapacity);
+		}
+
+		/**
+		 * @brief Amplía el rango de claves admitidas. No reduce el rango actual.
+		 */
+		void Resize(uint32_t KeyCapacity)
+		{
+			if (KeyCapacity > Heap.Positions.size())
+			{
+				Heap.Positions.resize(KeyCapacity, Detail::TDaryHeap<P, Compare, Arity>::InvalidPosition);
+			}
+		}
+
+		/**
+		 * @brief Inserta la clave o actualiza su prioridad si ya estaba encolada.
+		 */
+		void Push(uint32_t Key, const P& Priority)
+		{
+			if (Key >= Heap.Positions.size())
+			{
+				Resize(Key + 1);
+			}
+			if (Contains(Key))
+			{
+				Update(Key, Priority);
+				return;
+			}
+			Heap.Insert(Key, Priority);
+		}
+
+		/**
+		 * @brief Añade una clave sin restaurar el heap. Llamar a Heapify() antes de consultar.
+		 *
+		 * Si la clave ya estaba encolada solo se reemplaza su prioridad, igual que en Push().
+		 */
+		void PushUnordered(uint32_t Key, const P& Priority)
+		{
+			if (Key >= Heap.Positions.size())
+			{
+				Resize(Key + 1);
+			}
+			if (Contains(Key))
+			{
+				Heap.Nodes[Heap.Positions[Key]].Priority = Priority;
+				return;
+			}
+			Heap.Positions[Key] = static_cast<uint32_t>(Heap.Nodes.size());
+			Heap.Nodes.push_back(Detail::THeapNode<P>{ Priority, Key });
+		}
+
+		/**
+		 * @brief Restaura el heap tras una serie de PushUnordered.
+		 */
+		void Heapify()
+		{
+			Heap.Heapify();
+		}
+
+		/**
+		 * @brief Cambia la prioridad de una clave encolada.
+		 *
+		 * @return false si la clave no está en la cola.
+		 */
+		bool Update(uint32_t Key, const P& NewPriority)
+		{
+			if (!Contains(Key))
+			{
+				return false;
+			}
+			const uint32_t Position = Heap.Positions[Key];
+			Heap.Nodes[Position].Priority = NewPriority;
+			Heap.Fix(Position);
+			return true;
+		}
+
+		/**
+		 * @brief Mejora la prioridad de una clave. Solo recorre el heap hacia arriba.
+		 */
+		bool DecreaseKey(uint32_t Key, const P& NewPriority)
+		{
+			if (!Contains(Key))
+			{
+				return false;
+			}
+			const uint32_t Position = Heap.Positions[Key];
+			if (Heap.Comp(Heap.Nodes[Position].Priority, NewPriority))
+			{
+				return false;
+			}
+			Heap.Nodes[Position].Priority = NewPriority;
+			Heap.SiftUp(Position);
+			return true;
+		}
+
+		/**
+		 * @brief Retira una clave de la cola.
+		 */
+		bool Remove(uint32_t Key)
+		{
+			if (!Contains(Key))
+			{
+				return false;
+			}
+			Heap.EraseAt(Heap.Positions[Key]);
+			return true;
+		}
+
+		/**
+		 * @brief Indica si la clave está encolada.
+		 */
+		bool Contains(uint32_t Key) const
+		{
+			return Key < Heap.Positions.size()
+				&& Heap.Positions[Key] != Detail::TDaryHeap<P, Compare, Arity>::InvalidPosition;
+		}
+
+		/**
+		 * @brief Clave en la cima. La cola no debe estar vacía.
+		 */
+		uint32_t TopKey() const { return Heap.Nodes[0].Id; }
+
+		/**
+		 * @brief Prioridad de la cima. La cola no debe estar vacía.
+		 */
+		const P& TopPriority() const { return Heap.Nodes[0].Priority; }
+
+		/**
+		 * @brief Extrae la clave de la cima.
+		 */
+		uint32_t Pop() { return Heap.EraseAt(0); }
+
+		/**
+		 * @brief Prioridad actual de una clave encolada.
+		 */
+		const P& GetPriority(uint32_t Key) const { return Heap.Nodes[Heap.Positions[Key]].Priority; }
+
+		size_t Num() const { return Heap.Nodes.size(); }
+		bool IsEmpty() const { return Heap.Nodes.empty(); }
+
+		/**
+		 * @brief Vacía la cola conservando el rango de claves.
+		 */
+		void Clear()
+		{
+			for (const Detail::THeapNode<P>& Node : Heap.Nodes)
+			{
+				Heap.Positions[Node.Id] = Detail::TDaryHeap<P, Compare, Arity>::InvalidPosition;
+			}
+			Heap.Nodes.clear();
+		}
+
+	private:
+		Detail::TDaryHeap<P, Compare, Arity> Heap;  ///< Heap de (prioridad, clave).
+	};
+
+	// EXAMPLE
+
+	/*
+	int main()
+	{
+		// Peticiones de streaming ordenadas por distancia a la cámara (la más cercana primero)
+		EU::TPriorityQueue<std::string> Requests;
+		auto Far = Requests.Push("terrain_lod0", 120.0f);
+		Requests.Push("fox", 15.0f);
+		Requests.Push("piano", 40.0f);
+
+		// La cámara se acerca al terreno: se actualiza la prioridad sin reinsertar
+		Requests.DecreaseKey(Far, 5.0f);
+
+		while (!Requests.IsEmpty())
+		{
+			std::cout << Requests.TopPriority() << " " << Requests.Pop() << std::endl;
+		}
+
+		// Trabajos por fecha límite con claves densas
+		EU::TIndexedPriorityQueue<double> Jobs(64);
+		Jobs.Push(3, 16.6);
+		Jobs.Push(7, 8.3);
+		Jobs.Update(3, 4.0);
+		std::cout << "Next job: " << Jobs.Pop() << std::endl;  // 3
+
+		return 0;
+	}
+	*/
+}
@@ -0,0 +1,698 @@
+﻿/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include "EngineUtilities/Structures/TPair.h"
+#include "EngineUtilities/Utilities/TName.h"
+#include "EngineUtilities/Vectors/Vector2.h"
+#include "EngineUtilities/Vectors/Vector3.h"
+#include "EngineUtilities/Vectors/Vector4.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define EU_HASH_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define EU_HASH_SSE2 1
+#endif
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace EU {
+	/**
+	 * @brief Resultado de un hash de 128 bits.
+	 */
+	struct THash128
+	{
+		uint64_t Low;   ///< 64 bits bajos.
+		uint64_t High;  ///< 64 bits altos.
+
+		bool operator==(const THash128& Other) const { return Low == Other.Low && High == Other.High; }
+		bool operator!=(const THash128& Other) const { return !(*this == Other); }
+	};
+
+	namespace Detail {
+		constexpr uint64_t HashP0 = 0xa0761d6478bd642full;
+		constexpr uint64_t HashP1 = 0xe7037ed1a0b428dbull;
+		constexpr uint64_t HashP2 = 0x8ebc6af09c88c6e3ull;
+		constexpr uint64_t HashP3 = 0x589965cc75374cc3ull;
+		constexpr uint32_t HashPrime32 = 0x9E3779B1u;
+
+		constexpr size_t HashShortLimit = 256;     ///< Entradas hasta este tamaño usan la ruta corta.
+		constexpr size_t HashStripeSize = 64;      ///< Bytes consumidos por franja en la ruta larga.
+		constexpr size_t HashStripesPerBlock = 16; ///< Franjas entre cada mezcla de acumuladores.
+
+		/**
+		 * @brief Claves de la ruta larga. Cada franja usa una ventana desplazada 8 bytes.
+		 */
+		alignas(32) constexpr uint64_t HashSecret[24] = {
+			0xe8e2f2463f3de1caull, 0xcb61c10f9aff51caull, 0xe72b35924af8272cull, 0x6b3e408b1d20b044ull,
+			0x1e901d75b6c8f1f9ull, 0xd2bab54319e29b75ull, 0xca645a4149ba2d13ull, 0x5937755c904a60baull,
+			0xfb863b65a761348cull, 0xd33f9c5835df008full, 0x13f0eb764a01b1dcull, 0x79889b045dd93947ull,
+			0xc10b7b4db9004932ull, 0xb8fc9914d700dcf5ull, 0xb2fe33fcedb4435aull, 0x80a927c229d6736dull,
+			0x7ea1fe51e4020585ull, 0xa37266f7e7a2de5aull, 0x5f3997924862eec0ull, 0x05f3d745b38171f1ull,
+			0x7574d0dcf4794510ull, 0x7af6c79c0398a762ull, 0x464122b28321597dull, 0xec01ecc8342bfdf2ull,
+		};
+
+		/**
+		 * @brief Multiplicación 64x64 -> 128: A recibe la parte baja y B la alta.
+		 */
+		inline void Mum(uint64_t& A, uint64_t& B)
+		{
+#if defined(__SIZEOF_INT128__)
+			__uint128_t R = static_cast<__uint128_t>(A) * B;
+			A = static_cast<uint64_t>(R);
+			B = static_cast<uint64_t>(R >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+			A = _umul128(A, B, &B);
+#else
+			const uint64_t AHi = A >> 32, ALo = static_cast<uint32_t>(A);
+			const uint64_t BHi = B >> 32, BLo = static_cast<uint32_t>(B);
+			const uint64_t RHi = AHi * BHi, RMid0 = AHi * BLo, RMid1 = BHi * ALo, RLo = ALo * BLo;
+			const uint64_t T = RLo + (RMid0 << 32);
+			uint64_t Carry = T < RLo;
+			const uint64_t Lo = T + (RMid1 << 32);
+			Carry += Lo < T;
+			A = Lo;
+			B = RHi + (RMid0 >> 32) + (RMid1 >> 32) + Carry;
+#endif
+		}
+
+		/**
+		 * @brief Multiplica y pliega las dos mitades del producto.
+		 */
+		inline uint64_t Mix(uint64_t A, uint64_t B)
+		{
+			Mum(A, B);
+			return A ^ B;
+		}
+
+		inline uint64_t Avalanche(uint64_t H)
+		{
+			H ^= H >> 37;
+			H *= 0x165667919E3779F9ull;
+			H ^= H >> 32;
+			return H;
+		}
+
+		inline uint64_t Read64(const uint8_t* P)
+		{
+			uint64_t V;
+			std::memcpy(&V, P, sizeof(V));
+			return V;
+		}
+
+		inline uint64_t Read32(const uint8_t* P)
+		{
+			uint32_t V;
+			std::memcpy(&V, P, sizeof(V));
+			return V;
+		}
+
+		inline uint64_t Read3(const uint8_t* P, size_t Len)
+		{
+			return (static_cast<uint64_t>(P[0]) << 16) | (static_cast<uint64_t>(P[Len >> 1]) << 8) | P[Len - 1];
+		}
+
+		/**
+		 * @brief Ruta corta (estilo wyhash) para entradas de hasta HashShortLimit bytes.
+		 */
+		inline THash128 HashShort(const uint8_t* P, size_t Len, uint64_t Seed)
+		{
+			Seed ^= Mix(Seed ^ HashP0, HashP1);
+			uint64_t A, B;
+			if (Len <= 16)
+			{
+				if (Len >= 4)
+				{
+					const size_t Shift = (Len >> 3) << 2;
+					A = (Read32(P) << 32) | Read32(P + Shift);
+					B = (Read32(P + Len - 4) << 32) | Read32(P + Len - 4 - Shift);
+				}
+				else if (Len > 0)
+				{
+					A = Read3(P, Len);
+					B = 0;
+				}
+				else
+				{
+					A = B = 0;
+				}
+			}
+			else
+			{
+				size_t I = Len;
+				if (I > 48)
+				{
+					uint64_t See1 = Seed, See2 = Seed;
+					do
+					{
+						Seed = Mix(Read64(P) ^ HashP1, Read64(P + 8) ^ Seed);
+						See1 = Mix(Read64(P + 16) ^ HashP2, Read64(P + 24) ^ See1);
+						See2 = Mix(Read64(P + 32) ^ HashP3, Read64(P + 40) ^ See2);
+						P += 48;
+						I -= 48;
+					} while (I > 48);
+					Seed ^= See1 ^ See2;
+				}
+				while (I > 16)
+				{
+					Seed = Mix(Read64(P) ^ HashP1, Read64(P + 8) ^ Seed);
+					I -= 16;
+					P += 16;
+				}
+				A = Read64(P + I - 16);
+				B = Read64(P + I - 8);
+			}
+			A ^= HashP1;
+			B ^= Seed;
+			Mum(A, B);
+			THash128 Result;
+			Result.Low = Mix(A ^ HashP0 ^ Len, B ^ HashP1);
+			Result.High = Mix(B ^ HashP2 ^ Len, A ^ HashP3);
+			return Result;
+		}
+
+		/**
+		 * @brief Estado de la ruta larga: 8 acumuladores de 64 bits y el número de franjas procesadas.
+		 */
+		struct alignas(32) THashLongState
+		{
+			uint64_t Acc[8];
+			uint64_t StripeIndex;
+
+			void Init(uint64_t Seed)
+			{
+				Acc[0] = 0x00000000C2B2AE3Dull + Seed;
+				Acc[1] = 0x9E3779B185EBCA87ull - Seed;
+				Acc[2] = 0xC2B2AE3D27D4EB4Full + Seed;
+				Acc[3] = 0x165667B19E3779F9ull - Seed;
+				Acc[4] = 0x85EBCA77C2B2AE63ull + Seed;
+				Acc[5] = 0x0000000085EBCA77ull - Seed;
+				Acc[6] = 0x27D4EB2F165667C5ull + Seed;
+				Acc[7] = 0x000000009E3779B1ull - Seed;
+				StripeIndex = 0;
+			}
+		};
+
+		/**
+		 * @brief Acumula una franja de 64 bytes. Las tres variantes producen el mismo resultado.
+		 *
+		 * Por carril: Acc[i] += Low32(D ^ K) * High32(D ^ K) + Data[i ^ 1].
+		 */
+		inline void AccumulateStripe(uint64_t* Acc, const uint8_t* Data, const uint64_t* Secret)
+		{
+#if defined(EU_HASH_AVX2)
+			for (int i = 0; i < 2; ++i)
+			{
+				const __m256i D = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Data) + i);
+				const __m256i K = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Secret) + i);
+				const __m256i DK = _mm256_xor_si256(D, K);
+				const __m256i DKHi = _mm256_shuffle_epi32(DK, _MM_SHUFFLE(0, 3, 0, 1));
+				const __m256i Product = _mm256_mul_epu32(DK, DKHi);
+				const __m256i Swapped = _mm256_shuffle_epi32(D, _MM_SHUFFLE(1, 0, 3, 2));
+				__m256i* A = reinterpret_cast<__m256i*>(Acc) + i;
+				*A = _mm256_add_epi64(*A, _mm256_add_epi64(Product, Swapped));
+			}
+#elif defined(EU_HASH_SSE2)
+			for (int i = 0; i < 4; ++i)
+			{
+				const __m128i D = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data) + i);
+				const __m128i K = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Secret) + i);
+				const __m128i DK = _mm_xor_si128(D, K);
+				const __m128i DKHi = _mm_shuffle_epi32(DK, _MM_SHUFFLE(0, 3, 0, 1));
+				const __m128i Product = _mm_mul_epu32(DK, DKHi);
+				const __m128i Swapped = _mm_shuffle_epi32(D, _MM_SHUFFLE(1, 0, 3, 2));
+				__m128i* A = reinterpret_cast<__m128i*>(Acc) + i;
+				*A = _mm_add_epi64(*A, _mm_add_epi64(Product, Swapped));
+			}
+#else
+			for (int i = 0; i < 8; ++i)
+			{
+				const uint64_t D = Read64(Data + 8 * i);
+				const uint64_t DK = D ^ Secret[i];
+				Acc[i ^ 1] += D;
+				Acc[i] += (DK & 0xFFFFFFFFull) * (DK >> 32);
+			}
+#endif
+		}
+
+		/**
+		 * @brief Mezcla los acumuladores cada bloque para que no se saturen sus bits altos.
+		 */
+		inline void ScrambleAcc(uint64_t* Acc, const uint64_t* Secret)
+		{
+#if defined(EU_HASH_AVX2)
+			const __m256i Prime = _mm256_set1_epi32(static_cast<int>(HashPrime32));
+			for (int i = 0; i < 2; ++i)
+			{
+				__m256i* A = reinterpret_cast<__m256i*>(Acc) + i;
+				const __m256i K = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Secret) + i);
+				__m256i V = _mm256_xor_si256(*A, _mm256_srli_epi64(*A, 47));
+				V = _mm256_xor_si256(V, K);
+				const __m256i ProdLo = _mm256_mul_epu32(V, Prime);
+				const __m256i ProdHi = _mm256_mul_epu32(_mm256_shuffle_epi32(V, _MM_SHUFFLE(0, 3, 0, 1)), Prime);
+				*A = _mm256_add_epi64(ProdLo, _mm256_slli_epi64(ProdHi, 32));
+			}
+#elif defined(EU_HASH_SSE2)
+			const __m128i Prime = _mm_set1_epi32(static_cast<int>(HashPrime32));
+			for (int i = 0; i < 4; ++i)
+			{
+				__m128i* A = reinterpret_cast<__m128i*>(Acc) + i;
+				const __m128i K = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Secret) + i);
+				__m128i V = _mm_xor_si128(*A, _mm_srli_epi64(*A, 47));
+				V = _mm_xor_si128(V, K);
+				const __m128i ProdLo = _mm_mul_epu32(V, Prime);
+				const __m128i ProdHi = _mm_mul_epu32(_mm_shuffle_epi32(V, _MM_SHUFFLE(0, 3, 0, 1)), Prime);
+				*A = _mm_add_epi64(ProdLo, _mm_slli_epi64(ProdHi, 32));
+			}
+#else
+			for (int i = 0; i < 8; ++i)
+			{
+				uint64_t V = Acc[i];
+				V ^= V >> 47;
+				V ^= Secret[i];
+				Acc[i] = V * HashPrime32;
+			}
+#endif
+		}
+
+		inline void ProcessStripes(THashLongState& State, const uint8_t* Data, size_t NumStripes)
+		{
+			for (size_t i = 0; i < NumStripes; ++i)
+			{
+				AccumulateStripe(State.Acc, Data + i * HashStripeSize, HashSecret + (State.StripeIndex % HashStripesPerBlock));
+				if (++State.StripeIndex % HashStripesPerBlock == 0)
+				{
+					ScrambleAcc(State.Acc, HashSecret + HashStripesPerBlock);
+				}
+			}
+		}
+
+		/**
+		 * @brief Procesa el resto final (menos de una franja) rellenándolo con ceros.
+		 */
+		inline void ProcessTail(THashLongState& State, const uint8_t* Data, size_t Len)
+		{
+			if (Len == 0)
+			{
+				return;
+			}
+			uint8_t Last[HashStripeSize] = {};
+			std::memcpy(Last, Data, Len);
+			ProcessStripes(State, Last, 1);
+		}
+
+		inline THash128 FinalizeLong(const THashLongState& State, uint64_t TotalLen)
+		{
+			uint64_t Low = TotalLen * HashP0;
+			uint64_t High = ~(TotalLen * HashP1);
+			for (int i = 0; i < 4; ++i)
+			{
+				Low += Mix(State.Acc[2 * i] ^ HashSecret[2 * i + 3], State.Acc[2 * i + 1] ^ HashSecret[2 * i + 4]);
+				High += Mix(State.Acc[2 * i] ^ HashSecret[2 * i + 11], State.Acc[2 * i + 1] ^ HashSecret[2 * i + 12]);
+			}
+			THash128 Result;
+			Result.Low = Avalanche(Low);
+			Result.High = Avalanche(High);
+			return Result;
+		}
+
+		inline THash128 HashLong(const uint8_t* P, size_t Len, uint64_t Seed)
+		{
+			THashLongState State;
+			State.Init(Seed);
+			const size_t NumStripes = Len / HashStripeSize;
+			ProcessStripes(State, P, NumStripes);
+			ProcessTail(State, P + NumStripes * HashStripeSize, Len % HashStripeSize);
+			return FinalizeLong(State, Len);
+		}
+	}
+
+	/**
+	 * @brief Hash de 128 bits de un bloque de memoria.
+	 *
+	 * Entradas cortas (claves, nombres, vectores) usan una ruta escalar de pocas multiplicaciones;
+	 * a partir de 256 bytes se usa una ruta por franjas de 64 bytes con 8 acumuladores que se
+	 * vectoriza con SSE2 o AVX2 según el conjunto de instrucciones de compilación (/arch:AVX2).
+	 * El resultado es el mismo en las tres variantes. No es criptográfico.
+	 *
+	 * @param Data Puntero a los datos.
+	 * @param Len Número de bytes.
+	 * @param Seed Semilla opcional.
+	 * @return Hash de 128 bits.
+	 */
+	inline THash128 HashBytes128(const void* Data, size_t Len, uint64_t Seed = 0)
+	{
+		const uint8_t* P = static_cast<const uint8_t*>(Data);
+		return Len <= Detail::HashShortLimit ? Detail::HashShort(P, Len, Seed) : Detail::HashLong(P, Len, Seed);
+	}
+
+	/**
+	 * @brief Hash de 64 bits de un bloque de memoria. Son los 64 bits bajos de HashBytes128.
+	 */
+	inline uint64_t HashBytes64(const void* Data, size_t Len, uint64_t Seed = 0)
+	{
+		return HashBytes128(Data, Len, Seed).Low;
+	}
+
+	/**
+	 * @brief Mezcla un entero de 64 bits; más barato que HashBytes64 para claves escalares.
+	 */
+	inline uint64_t HashInt64(uint64_t Value, uint64_t Seed = 0)
+	{
+		return Detail::Mix(Value ^ Detail::HashP0 ^ Seed, Detail::HashP1 ^ (Seed >> 1));
+	}
+
+	/**
+	 * @brief Combina un hash con otro, dependiente del orden.
+	 */
+	inline uint64_t HashCombine(uint64_t Seed, uint64_t Value)
+	{
+		return Detail::Mix(Seed ^ Detail::HashP2, Value ^ Detail::HashP3);
+	}
+
+	/**
+	 * @brief Hash incremental: produce el mismo valor que HashBytes128 sobre la concatenación de
+	 * todos los bloques pasados a Update, sin necesidad de tenerlos juntos en memoria.
+	 *
+	 * Útil para hashear el contenido de un asset por partes (vértices, índices, texturas).
+	 */
+	class THasher
+	{
+	public:
+		/**
+		 * @brief Constructor.
+		 *
+		 * @param InSeed Semilla del hash.
+		 */
+		explicit THasher(uint64_t InSeed = 0) { Reset(InSeed); }
+
+		/**
+		 * @brief Reinicia el hasher para empezar un hash nuevo.
+		 */
+		void Reset(uint64_t InSeed = 0)
+		{
+			Seed = InSeed;
+			TotalLen = 0;
+			BufferLen = 0;
+			State.Init(Seed);
+		}
+
+		/**
+		 * @brief Añade un bloque de bytes al hash.
+		 */
+		void Update(const void* Data, size_t Len)
+		{
+			const uint8_t* P = static_cast<const uint8_t*>(Data);
+			TotalLen += Len;
+
+			if (TotalLen <= Detail::HashShortLimit)
+			{
+				std::memcpy(Buffer + BufferLen, P, Len);
+				BufferLen += Len;
+				return;
+			}
+
+			// Ruta larga: vaciar las franjas completas del buffer
+			const size_t Buffered = BufferLen / Detail::HashStripeSize;
+			Detail::ProcessStripes(State, Buffer, Buffered);
+			BufferLen -= Buffered * Detail::HashStripeSize;
+			std::memmove(Buffer, Buffer + Buffered * Detail::HashStripeSize, BufferLen);
+
+			// Completar la franja parcial
+			if (BufferLen > 0)
+			{
+				const size_t Take = (std::min)(Len, Detail::HashStripeSize - BufferLen);
+				std::memcpy(Buffer + BufferLen, P, Take);
+				BufferLen += Take;
+				P += Take;
+				Len -= Take;
+				if (BufferLen < Detail::HashStripeSize)
+				{
+					return;
+				}
+				Detail::ProcessStripes(State, Buffer, 1);
+				BufferLen = 0;
+			}
+
+			// Franjas completas directamente desde la entrada, sin copiar
+			const size_t NumStripes = Len / Detail::HashStripeSize;
+			Detail::ProcessStripes(State, P, NumStripes);
+			P += NumStripes * Detail::HashStripeSize;
+			Len -= NumStripes * Detail::HashStripeSize;
+
+			std::memcpy(Buffer, P, Len);
+			BufferLen = Len;
+		}
+
+		/**
+		 * @brief Añade un valor trivialmente copiable como bytes.
+		 */
+		template<typename T>
+		void UpdateValue(const T& Value)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "UpdateValue requires a trivially copyable type");
+			Update(&Value, sizeof(T));
+		}
+
+		/**
+		 * @brief Hash de 128 bits de todo lo añadido. No modifica el estado.
+		 */
+		THash128 Finalize128() const
+		{
+			if (TotalLen <= Detail::HashShortLimit)
+			{
+				return Detail::HashShort(Buffer, BufferLen, Seed);
+			}
+			Detail::THashLongState Final = State;
+			const size_t NumStripes = BufferLen / Detail::HashStripeSize;
+			Detail::ProcessStripes(Final, Buffer, NumStripes);
+			Detail::ProcessTail(Final, Buffer + NumStripes * Detail::HashStripeSize, BufferLen % Detail::HashStripeSize);
+			return Detail::FinalizeLong(Final, TotalLen);
+		}
+
+		/**
+		 * @brief Hash de 64 bits de todo lo añadido.
+		 */
+		uint64_t Finalize64() const { return Finalize128().Low; }
+
+	private:
+		Detail::THashLongState State;                    ///< Acumuladores de la ruta larga.
+		uint8_t Buffer[Detail::HashShortLimit];           ///< Datos pendientes de procesar.
+		size_t BufferLen;                                 ///< Bytes válidos en Buffer.
+		uint64_t TotalLen;                                ///< Bytes añadidos en total.
+		uint64_t Seed;                                    ///< Semilla del hash.
+	};
+
+	/**
+	 * @brief Functor de hash para contenedores. Se especializa por tipo.
+	 *
+	 * Se puede usar directamente como parámetro Hash de std::unordered_map:
+	 * std::unordered_map<EU::Vector3, int, EU::Hash<EU::Vector3>>.
+	 */
+	template<typename T, typename Enable = void>
+	struct Hash;
+
+	/**
+	 * @brief Hash para enteros, enumeraciones y punteros.
+	 */
+	template<typename T>
+	struct Hash<T, std::enable_if_t<std::is_integral<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value>>
+	{
+		size_t operator()(const T& Value) const
+		{
+			uint64_t Bits = 0;
+			std::memcpy(&Bits, &Value, sizeof(T));
+			return static_cast<size_t>(HashInt64(Bits));
+		}
+	};
+
+	namespace Detail {
+		/**
+		 * @brief Hash de floats que trata -0.0 y 0.0 como iguales, como hace operator==.
+		 */
+		inline uint64_t HashFloats(const float* Values, size_t Count)
+		{
+			float Normalized[4];
+			for (size_t i = 0; i < Count; ++i)
+			{
+				Normalized[i] = Values[i] == 0.0f ? 0.0f : Values[i];
+			}
+			return HashBytes64(Normalized, Count * sizeof(float));
+		}
+	}
+
+	template<>
+	struct Hash<float>
+	{
+		size_t operator()(float Value) const { return static_cast<size_t>(Detail::HashFloats(&Value, 1)); }
+	};
+
+	template<>
+	struct Hash<double>
+	{
+		size_t operator()(double Value) const
+		{
+			Value = Value == 0.0 ? 0.0 : Value;
+			uint64_t Bits;
+			std::memcpy(&Bits, &Value, sizeof(Bits));
+			return static_cast<size_t>(HashInt64(Bits));
+		}
+	};
+
+	template<>
+	struct Hash<std::string_view>
+	{
+		size_t operator()(std::string_view Str) const { return static_cast<size_t>(HashBytes64(Str.data(), Str.size())); }
+	};
+
+	template<>
+	struct Hash<std::string>
+	{
+		size_t operator()(const std::string& Str) const { return static_cast<size_t>(HashBytes64(Str.data(), Str.size())); }
+	};
+
+	template<>
+	struct Hash<std::wstring>
+	{
+		size_t operator()(const std::wstring& Str) const
+		{
+			return static_cast<size_t>(HashBytes64(Str.data(), Str.size() * sizeof(wchar_t)));
+		}
+	};
+
+	/**
+	 * @brief Hash de TName: mezcla el índice internado, sin leer la cadena.
+	 *
+	 * El valor depende del orden en que se internaron los nombres, así que solo es estable durante
+	 * una ejecución. Para claves persistentes usar Hash<std::string_view> sobre Name.view().
+	 */
+	template<>
+	struct Hash<TName>
+	{
+		size_t operator()(const TName& Name) const { return static_cast<size_t>(HashInt64(Name.getIndex())); }
+	};
+
+	template<>
+	struct Hash<Vector2>
+	{
+		size_t operator()(const Vector2& V) const
+		{
+			const float Values[2] = { V.x, V.y };
+			return static_cast<size_t>(Detail::HashFloats(Values, 2));
+		}
+	};
+
+	template<>
+	struct Hash<Vector3>
+	{
+		size_t operator()(const Vector3& V) const
+		{
+			const float Values[3] = { V.x, V.y, V.z };
+			return static_cast<size_t>(Detail::HashFloats(Values, 3));
+		}
+	};
+
+	template<>
+	struct Hash<Vector4>
+	{
+		size_t operator()(const Vector4& V) const
+		{
+			const float Values[4] = { V.x, V.y, V.z, V.w };
+			return static_cast<size_t>(Detail::HashFloats(Values, 4));
+		}
+	};
+
+	template<typename KeyType, typename ValueType>
+	struct Hash<TPair<KeyType, ValueType>>
+	{
+		size_t operator()(const TPair<KeyType, ValueType>& Pair) const
+		{
+			return static_cast<size_t>(HashCombine(Hash<KeyType>()(Pair.Key), Hash<ValueType>()(Pair.Value)));
+		}
+	};
+
+	/**
+	 * @brief Atajo para hashear un valor con su especialización de Hash.
+	 */
+	template<typename T>
+	size_t GetTypeHash(const T& Value)
+	{
+		return Hash<T>()(Value);
+	}
+
+	// EXAMPLE
+
+	/*
+	// Benchmark de rendimiento en GB/s. Compilar en Release (y con /arch:AVX2 para la ruta AVX2).
+	#include <chrono>
+	#include <vector>
+
+	int main()
+	{
+		std::vector<uint8_t> Data(64 * 1024 * 1024);
+		for (size_t i = 0; i < Data.size(); ++i) Data[i] = static_cast<uint8_t>(i * 31);
+
+		for (size_t Size : { 16u, 256u, 4096u, 64u * 1024u * 1024u })
+		{
+			const size_t Iterations = (256u * 1024u * 1024u) / Size;
+			uint64_t Sink = 0;
+			auto Start = std::chrono::high_resolution_clock::now();
+			for (size_t i = 0; i < Iterations; ++i)
+			{
+				Sink += EU::HashBytes64(Data.data(), Size, i);
+			}
+			double Seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - Start).count();
+			std::cout << Size << " bytes: " << (double(Size) * Iterations / Seconds / 1e9) << " GB/s (" << Sink << ")" << std::endl;
+		}
+
+		// Hash incremental del contenido de una malla: igual que hashear el buffer completo
+		EU::THasher Hasher;
+		Hasher.Update(Data.data(), 1000);
+		Hasher.Update(Data.data() + 1000, 3000);
+		std::cout << (Hasher.Finalize128() == EU::HashBytes128(Data.data(), 4000)) << std::endl;  // 1
+
+		std::unordered_map<EU::TName, int, EU::Hash<EU::TName>> MeshIds;
+		MeshIds["Plane"] = 0;
+		std::cout << EU::GetTypeHash(EU::Vector3(1.0f, 2.0f, 3.0f)) << std::endl;
+
+		return 0;
+	}
+	*/
+}
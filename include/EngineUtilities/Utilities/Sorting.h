@@ -0,0 +1,622 @@
+﻿/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "EngineUtilities/Structures/TArray.h"
+
+namespace EU {
+	namespace Detail {
+		constexpr ptrdiff_t InsertionSortThreshold = 24;      ///< Rangos menores se ordenan por inserción.
+		constexpr ptrdiff_t NintherThreshold = 128;           ///< A partir de aquí el pivote es un ninther.
+		constexpr ptrdiff_t PartialInsertionSortLimit = 8;    ///< Movimientos tolerados antes de abandonar.
+
+		template<typename T, typename Compare>
+		void InsertionSort(T* First, T* Last, Compare Comp)
+		{
+			if (First == Last)
+			{
+				return;
+			}
+			for (T* Cur = First + 1; Cur != Last; ++Cur)
+			{
+				T* Sift = Cur;
+				T* Prev = Cur - 1;
+				if (Comp(*Sift, *Prev))
+				{
+					T Tmp = std::move(*Sift);
+					do
+					{
+						*Sift-- = std::move(*Prev);
+					} while (Sift != First && Comp(Tmp, *--Prev));
+					*Sift = std::move(Tmp);
+				}
+			}
+		}
+
+		/**
+		 * @brief Inserción sin comprobación de límite: requiere que exista un elemento menor
+		 * o igual a la izquierda de First (el pivote de la partición anterior).
+		 */
+		template<typename T, typename Compare>
+		void UnguardedInsertionSort(T* First, T* Last, Compare Comp)
+		{
+			if (First == Last)
+			{
+				return;
+			}
+			for (T* Cur = First + 1; Cur != Last; ++Cur)
+			{
+				T* Sift = Cur;
+				T* Prev = Cur - 1;
+				if (Comp(*Sift, *Prev))
+				{
+					T Tmp = std::move(*Sift);
+					do
+					{
+						*Sift-- = std::move(*Prev);
+					} while (Comp(Tmp, *--Prev));
+					*Sift = std::move(Tmp);
+				}
+			}
+		}
+
+		/**
+		 * @brief Intenta ordenar por inserción; abandona si hay que mover demasiados elementos.
+		 *
+		 * @return true si el rango quedó ordenado.
+		 */
+		template<typename T, typename Compare>
+		bool PartialInsertionSort(T* First, T* Last, Compare Comp)
+		{
+			if (First == Last)
+			{
+				return true;
+			}
+			ptrdiff_t Moved = 0;
+			for (T* Cur = First + 1; Cur != Last; ++Cur)
+			{
+				T* Sift = Cur;
+				T* Prev = Cur - 1;
+				if (Comp(*Sift, *Prev))
+				{
+					T Tmp = std::move(*Sift);
+					do
+					{
+						*Sift-- = std::move(*Prev);
+					} while (Sift != First && Comp(Tmp, *--Prev));
+					*Sift = std::move(Tmp);
+					Moved += Cur - Sift;
+				}
+				if (Moved > PartialInsertionSortLimit)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		template<typename T, typename Compare>
+		void Sort2(T* A, T* B, Compare Comp)
+		{
+			if (Comp(*B, *A))
+			{
+				std::iter_swap(A, B);
+			}
+		}
+
+		template<typename T, typename Compare>
+		void Sort3(T* A, T* B, T* C, Compare Comp)
+		{
+			Sort2(A, B, Comp);
+			Sort2(B, C, Comp);
+			Sort2(A, B, Comp);
+		}
+
+		/**
+		 * @brief Partición con el pivote en *First; los iguales al pivote van a la derecha.
+		 *
+		 * @return Posición final del pivote y si el rango ya estaba particionado.
+		 */
+		template<typename T, typename Compare>
+		std::pair<T*, bool> PartitionRight(T* First, T* Last, Compare Comp)
+		{
+			T Pivot = std::move(*First);
+			T* Begin = First;
+			T* End = Last;
+
+			while (Comp(*++Begin, Pivot));
+
+			if (Begin - 1 == First)
+			{
+				while (Begin < End && !Comp(*--End, Pivot));
+			}
+			else
+			{
+				while (!Comp(*--End, Pivot));
+			}
+
+			const bool AlreadyPartitioned = Begin >= End;
+
+			while (Begin < End)
+			{
+				std::iter_swap(Begin, End);
+				while (Comp(*++Begin, Pivot));
+				while (!Comp(*--End, Pivot));
+			}
+
+			T* PivotPos = Begin - 1;
+			*First = std::move(*PivotPos);
+			*PivotPos = std::move(Pivot);
+			return std::make_pair(PivotPos, AlreadyPartitioned);
+		}
+
+		/**
+		 * @brief Partición que agrupa a la izquierda los elementos iguales al pivote.
+		 *
+		 * Se usa cuando el pivote coincide con el de la partición anterior: todos los iguales
+		 * quedan colocados en un solo paso, lo que hace lineal el caso de muchas claves repetidas.
+		 */
+		template<typename T, typename Compare>
+		T* PartitionLeft(T* First, T* Last, Compare Comp)
+		{
+			T Pivot = std::move(*First);
+			T* Begin = First;
+			T* End = Last;
+
+			while (Comp(Pivot, *--End));
+
+			if (End + 1 == Last)
+			{
+				while (Begin < End && !Comp(Pivot, *++Begin));
+			}
+			else
+			{
+				while (!Comp(Pivot, *++Begin));
+			}
+
+			while (Begin < End)
+			{
+				std::iter_swap(Begin, End);
+				while (Comp(Pivot, *--End));
+				while (!Comp(Pivot, *++Begin));
+			}
+
+			T* PivotPos = End;
+			*First = std::move(*PivotPos);
+			*PivotPos = std::move(Pivot);
+			return PivotPos;
+		}
+
+		inline int Log2(size_t Value)
+		{
+			int Result = 0;
+			while (Value >>= 1)
+			{
+				++Result;
+			}
+			return Result;
+		}
+
+		template<typename T, typename Compare>
+		void PdqSortLoop(T* First, T* Last, Compare Comp, int BadAllowed, bool LeftMost)
+		{
+			for (;;)
+			{
+				const ptrdiff_t Size = Last - First;
+
+				if (Size < InsertionSortThreshold)
+				{
+					if (LeftMost)
+					{
+						InsertionSort(First, Last, Comp);
+					}
+					else
+					{
+						UnguardedInsertionSort(First, Last, Comp);
+					}
+					return;
+				}
+
+				// Pivote: mediana de 3 o ninther (mediana de medianas) en rangos grandes
+				const ptrdiff_t Half = Size / 2;
+				if (Size > NintherThreshold)
+				{
+					Sort3(First, First + Half, Last - 1, Comp);
+					Sort3(First + 1, First + (Half - 1), Last - 2, Comp);
+					Sort3(First + 2, First + (Half + 1), Last - 3, Comp);
+					Sort3(First + (Half - 1), First + Half, First + (Half + 1), Comp);
+					std::iter_swap(First, First + Half);
+				}
+				else
+				{
+					Sort3(First + Half, First, Last - 1, Comp);
+				}
+
+				// Si el pivote es igual al elemento anterior al rango, todo lo igual va a la izquierda
+				if (!LeftMost && !Comp(*(First - 1), *First))
+				{
+					First = PartitionLeft(First, Last, Comp) + 1;
+					continue;
+				}
+
+				std::pair<T*, bool> Result = PartitionRight(First, Last, Comp);
+				T* PivotPos = Result.first;
+				const bool AlreadyPartitioned = Result.second;
+
+				const ptrdiff_t LeftSize = PivotPos - First;
+				const ptrdiff_t RightSize = Last - (PivotPos + 1);
+				const bool Unbalanced = LeftSize < Size / 8 || RightSize < Size / 8;
+
+				if (Unbalanced)
+				{
+					// Demasiadas particiones malas: se cae a heapsort para garantizar O(n log n)
+					if (--BadAllowed == 0)
+					{
+						std::make_heap(First, Last, Comp);
+						std::sort_heap(First, Last, Comp);
+						return;
+					}
+
+					// Romper patrones que provocan particiones desbalanceadas
+					if (LeftSize >= InsertionSortThreshold)
+					{
+						std::iter_swap(First, First + LeftSize / 4);
+						std::iter_swap(PivotPos - 1, PivotPos - LeftSize / 4);
+						if (LeftSize > NintherThreshold)
+						{
+							std::iter_swap(First + 1, First + (LeftSize / 4 + 1));
+							std::iter_swap(First + 2, First + (LeftSize / 4 + 2));
+							std::iter_swap(PivotPos - 2, PivotPos - (LeftSize / 4 + 1));
+							std::iter_swap(PivotPos - 3, PivotPos - (LeftSize / 4 + 2));
+						}
+					}
+					if (RightSize >= InsertionSortThreshold)
+					{
+						std::iter_swap(PivotPos + 1, PivotPos + (1 + RightSize / 4));
+						std::iter_swap(Last - 1, Last - RightSize / 4);
+						if (RightSize > NintherThreshold)
+						{
+							std::iter_swap(PivotPos + 2, PivotPos + (2 + RightSize / 4));
+							std::iter_swap(PivotPos + 3, PivotPos + (3 + RightSize / 4));
+							std::iter_swap(Last - 2, Last - (1 + RightSize / 4));
+							std::iter_swap(Last - 3, Last - (2 + RightSize / 4));
+						}
+					}
+				}
+				else if (AlreadyPartitioned
+					&& PartialInsertionSort(First, PivotPos, Comp)
+					&& PartialInsertionSort(PivotPos + 1, Last, Comp))
+				{
+					// Entrada (casi) ordenada: resuelta en tiempo lineal
+					return;
+				}
+
+				// Recursión en la mitad izquierda, iteración en la derecha
+				PdqSortLoop(First, PivotPos, Comp, BadAllowed, LeftMost);
+				First = PivotPos + 1;
+				LeftMost = false;
+			}
+		}
+
+		/**
+		 * @brief Mezcla dos rangos ordenados contiguos usando un buffer auxiliar.
+		 */
+		template<typename T, typename Compare>
+		void MergeInto(T* First, T* Middle, T* Last, T* Out, Compare Comp)
+		{
+			std::merge(std::make_move_iterator(First), std::make_move_iterator(Middle),
+				std::make_move_iterator(Middle), std::make_move_iterator(Last), Out, Comp);
+		}
+	}
+
+	/**
+	 * @brief Ordena un rango contiguo con pattern-defeating quicksort.
+	 *
+	 * Caso medio O(n log n) como introsort, pero lineal en entradas ya ordenadas, invertidas o con
+	 * muchas claves repetidas, y con peor caso O(n log n) garantizado por la caída a heapsort.
+	 * No es estable.
+	 *
+	 * @param First Puntero al primer elemento.
+	 * @param Last Puntero a uno después del último elemento.
+	 * @param Comp Comparador estricto (por defecto operator<).
+	 */
+	template<typename T, typename Compare = std::less<T>>
+	void Sort(T* First, T* Last, Compare Comp = Compare())
+	{
+		if (Last - First < 2)
+		{
+			return;
+		}
+		Detail::PdqSortLoop(First, Last, Comp, Detail::Log2(static_cast<size_t>(Last - First)), true);
+	}
+
+	/**
+	 * @brief Ordena todos los elementos de un TArray con pattern-defeating quicksort.
+	 */
+	template<typename T, typename Compare = std::less<T>>
+	void Sort(TArray<T>& Array, Compare Comp = Compare())
+	{
+		Sort(Array.GetData(), Array.GetData() + Array.Num(), Comp);
+	}
+
+	/**
+	 * @brief Convierte un float en una clave entera cuyo orden sin signo coincide con el del float.
+	 *
+	 * Útil para ordenar por profundidad con RadixSort.
+	 */
+	inline uint32_t FloatToSortableKey(float Value)
+	{
+		uint32_t Bits;
+		std::memcpy(&Bits, &Value, sizeof(Bits));
+		const uint32_t Mask = (Bits & 0x80000000u) ? 0xFFFFFFFFu : 0x80000000u;
+		return Bits ^ Mask;
+	}
+
+	/**
+	 * @brief Ordena un rango por una clave entera de 32 o 64 bits con radix sort LSD.
+	 *
+	 * Procesa la clave en dígitos de 8 bits. Los histogramas de todos los dígitos se calculan en
+	 * una sola lectura y se omiten los pasos en que todas las claves comparten el dígito, así que
+	 * claves de pocos bits significativos (capas, materiales) cuestan pocos pasos. Es estable.
+	 *
+	 * @param First Puntero al primer elemento.
+	 * @param Last Puntero a uno después del último elemento.
+	 * @param Scratch Buffer auxiliar con espacio para (Last - First) elementos.
+	 * @param GetKey Función que devuelve la clave (uint32_t o uint64_t) de un elemento.
+	 */
+	template<typename T, typename KeyFunc>
+	void RadixSort(T* First, T* Last, T* Scratch, KeyFunc GetKey)
+	{
+		using KeyType = std::decay_t<decltype(GetKey(*First))>;
+		static_assert(std::is_same<KeyType, uint32_t>::value || std::is_same<KeyType, uint64_t>::value,
+			"RadixSort keys must be uint32_t or uint64_t");
+		constexpr size_t Passes = sizeof(KeyType);
+
+		const size_t Count = static_cast<size_t>(Last - First);
+		if (Count < 2)
+		{
+			return;
+		}
+
+		size_t Histograms[Passes][256] = {};
+		for (const T* It = First; It != Last; ++It)
+		{
+			const KeyType Key = GetKey(*It);
+			for (size_t Pass = 0; Pass < Passes; ++Pass)
+			{
+				++Histograms[Pass][(Key >> (Pass * 8)) & 0xFF];
+			}
+		}
+
+		T* Src = First;
+		T* Dst = Scratch;
+		for (size_t Pass = 0; Pass < Passes; ++Pass)
+		{
+			size_t* Histogram = Histograms[Pass];
+			const size_t Digit0 = (GetKey(*Src) >> (Pass * 8)) & 0xFF;
+			if (Histogram[Digit0] == Count)
+			{
+				continue;  ///< Todas las claves comparten este dígito.
+			}
+
+			size_t Offset = 0;
+			for (size_t Bucket = 0; Bucket < 256; ++Bucket)
+			{
+				const size_t BucketCount = Histogram[Bucket];
+				Histogram[Bucket] = Offset;
+				Offset += BucketCount;
+			}
+
+			for (T* It = Src; It != Src + Count; ++It)
+			{
+				const size_t Digit = (GetKey(*It) >> (Pass * 8)) & 0xFF;
+				Dst[Histogram[Digit]++] = std::move(*It);
+			}
+			std::swap(Src, Dst);
+		}
+
+		if (Src != First)
+		{
+			std::move(Src, Src + Count, First);
+		}
+	}
+
+	/**
+	 * @brief Radix sort LSD que reserva su propio buffer auxiliar.
+	 *
+	 * Para ordenar cada frame conviene la versión con Scratch y reutilizar el buffer.
+	 */
+	template<typename T, typename KeyFunc>
+	void RadixSort(T* First, T* Last, KeyFunc GetKey)
+	{
+		std::vector<T> Scratch(static_cast<size_t>(Last - First));
+		RadixSort(First, Last, Scratch.data(), GetKey);
+	}
+
+	/**
+	 * @brief Radix sort LSD sobre un TArray.
+	 */
+	template<typename T, typename KeyFunc>
+	void RadixSort(TArray<T>& Array, KeyFunc GetKey)
+	{
+		RadixSort(Array.GetData(), Array.GetData() + Array.Num(), GetKey);
+	}
+
+	/**
+	 * @brief Ordena un rango grande repartiendo el trabajo entre varios hilos.
+	 *
+	 * Cada hilo ordena un bloque con EU::Sort y luego los bloques se mezclan por pares, también en
+	 * paralelo, alternando entre el rango y un buffer auxiliar (merge sort por bloques). En rangos
+	 * pequeños el coste de lanzar hilos no compensa y se usa EU::Sort directamente.
+	 *
+	 * @param First Puntero al primer elemento.
+	 * @param Last Puntero a uno después del último elemento.
+	 * @param Comp Comparador estricto.
+	 * @param NumThreads Hilos a usar; 0 usa std::thread::hardware_concurrency().
+	 */
+	template<typename T, typename Compare = std::less<T>>
+	void ParallelSort(T* First, T* Last, Compare Comp = Compare(), unsigned NumThreads = 0)
+	{
+		constexpr ptrdiff_t MinElementsPerThread = 1 << 15;
+
+		const ptrdiff_t Count = Last - First;
+		if (NumThreads == 0)
+		{
+			NumThreads = std::thread::hardware_concurrency();
+		}
+		const ptrdiff_t MaxUseful = Count / MinElementsPerThread;
+		if (static_cast<ptrdiff_t>(NumThreads) > MaxUseful)
+		{
+			NumThreads = static_cast<unsigned>(MaxUseful);
+		}
+		if (NumThreads < 2)
+		{
+			Sort(First, Last, Comp);
+			return;
+		}
+
+		// 1. Ordenar bloques independientes
+		std::vector<ptrdiff_t> Bounds(NumThreads + 1);
+		for (unsigned i = 0; i <= NumThreads; ++i)
+		{
+			Bounds[i] = Count * static_cast<ptrdiff_t>(i) / static_cast<ptrdiff_t>(NumThreads);
+		}
+
+		std::vector<std::thread> Workers;
+		Workers.reserve(NumThreads);
+		for (unsigned i = 0; i < NumThreads; ++i)
+		{
+			Workers.emplace_back([=]() { Sort(First + Bounds[i], First + Bounds[i + 1], Comp); });
+		}
+		for (std::thread& Worker : Workers)
+		{
+			Worker.join();
+		}
+
+		// 2. Mezclar bloques por pares hasta que quede uno
+		std::vector<T> Buffer(static_cast<size_t>(Count));
+		T* Src = First;
+		T* Dst = Buffer.data();
+		while (Bounds.size() > 2)
+		{
+			std::vector<ptrdiff_t> NextBounds;
+			NextBounds.reserve(Bounds.size() / 2 + 2);
+			Workers.clear();
+			size_t Block = 0;
+			for (; Block + 2 < Bounds.size(); Block += 2)
+			{
+				const ptrdiff_t Begin = Bounds[Block];
+				const ptrdiff_t Middle = Bounds[Block + 1];
+				const ptrdiff_t End = Bounds[Block + 2];
+				NextBounds.push_back(Begin);
+				Workers.emplace_back([=]() { Detail::MergeInto(Src + Begin, Src + Middle, Src + End, Dst + Begin, Comp); });
+			}
+			if (Block + 1 < Bounds.size())
+			{
+				// Bloque impar sin pareja: se copia tal cual
+				const ptrdiff_t Begin = Bounds[Block];
+				const ptrdiff_t End = Bounds[Block + 1];
+				NextBounds.push_back(Begin);
+				std::move(Src + Begin, Src + End, Dst + Begin);
+			}
+			NextBounds.push_back(Count);
+			for (std::thread& Worker : Workers)
+			{
+				Worker.join();
+			}
+			std::swap(Src, Dst);
+			Bounds.swap(NextBounds);
+		}
+
+		if (Src != First)
+		{
+			std::move(Src, Src + Count, First);
+		}
+	}
+
+	/**
+	 * @brief Ordenamiento paralelo de un TArray.
+	 */
+	template<typename T, typename Compare = std::less<T>>
+	void ParallelSort(TArray<T>& Array, Compare Comp = Compare(), unsigned NumThreads = 0)
+	{
+		ParallelSort(Array.GetData(), Array.GetData() + Array.Num(), Comp, NumThreads);
+	}
+
+	// EXAMPLE
+
+	/*
+	// Benchmark frente a std::sort. Compilar en Release.
+	#include <chrono>
+	#include <random>
+
+	template<typename F>
+	double MeasureMs(F Func)
+	{
+		auto Start = std::chrono::high_resolution_clock::now();
+		Func();
+		return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - Start).count();
+	}
+
+	int main()
+	{
+		std::mt19937_64 Rng(42);
+		for (size_t Count : { 1000u, 100000u, 4000000u })
+		{
+			std::vector<uint64_t> Keys(Count);
+			for (uint64_t& Key : Keys) Key = Rng();
+
+			std::vector<uint64_t> A = Keys, B = Keys, C = Keys, D = Keys, Scratch(Count);
+			double StdMs = MeasureMs([&]() { std::sort(A.begin(), A.end()); });
+			double PdqMs = MeasureMs([&]() { EU::Sort(B.data(), B.data() + Count); });
+			double RadixMs = MeasureMs([&]() { EU::RadixSort(C.data(), C.data() + Count, Scratch.data(), [](uint64_t K) { return K; }); });
+			double ParallelMs = MeasureMs([&]() { EU::ParallelSort(D.data(), D.data() + Count); });
+
+			std::cout << Count << " elements  std::sort " << StdMs << " ms  pdqsort " << PdqMs
+				<< " ms  radix " << RadixMs << " ms  parallel " << ParallelMs << " ms" << std::endl;
+		}
+
+		// Ordenar draw calls por profundidad (de atrás hacia delante)
+		struct DrawItem { float Depth; uint32_t Mesh; };
+		std::vector<DrawItem> Items = { { 3.0f, 0 }, { -1.0f, 1 }, { 10.0f, 2 } };
+		EU::RadixSort(Items.data(), Items.data() + Items.size(),
+			[](const DrawItem& Item) { return ~EU::FloatToSortableKey(Item.Depth); });
+
+		return 0;
+	}
+	*/
+}
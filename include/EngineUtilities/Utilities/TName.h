@@ -0,0 +1,337 @@
+﻿/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace EU {
+	/**
+	 * @brief Tabla global de cadenas internadas usada por TName.
+	 *
+	 * Cada cadena distinta se almacena una sola vez en bloques de memoria que nunca se mueven,
+	 * por lo que los punteros devueltos por c_str() son estables durante toda la ejecución.
+	 * La inserción está protegida por un mutex de lectura/escritura; la resolución de un índice
+	 * a su cadena no toma ningún lock.
+	 */
+	class TNameTable
+	{
+	public:
+		/**
+		 * @brief Entrada de la tabla: puntero a la cadena terminada en nulo y su longitud.
+		 */
+		struct Entry
+		{
+			const char* Str;
+			uint32_t Length;
+		};
+
+		/**
+		 * @brief Obtiene la instancia global de la tabla.
+		 *
+		 * @return Referencia a la tabla compartida por todos los TName.
+		 */
+		static TNameTable& Get()
+		{
+			static TNameTable Instance;
+			return Instance;
+		}
+
+		/**
+		 * @brief Interna una cadena y devuelve su índice.
+		 *
+		 * Si la cadena ya existe se devuelve el índice existente sin reservar memoria.
+		 * La cadena vacía siempre corresponde al índice 0.
+		 *
+		 * @param Str Cadena a internar.
+		 * @return Índice estable de la cadena en la tabla.
+		 */
+		uint32_t Intern(std::string_view Str)
+		{
+			if (Str.empty())
+			{
+				return 0;
+			}
+
+			{
+				std::shared_lock<std::shared_mutex> ReadLock(Mutex);
+				auto It = Lookup.find(Str);
+				if (It != Lookup.end())
+				{
+					return It->second;
+				}
+			}
+
+			std::unique_lock<std::shared_mutex> WriteLock(Mutex);
+			auto It = Lookup.find(Str);
+			if (It != Lookup.end())
+			{
+				return It->second;  ///< Otro hilo la insertó entre ambos locks.
+			}
+
+			const uint32_t Index = Count.load(std::memory_order_relaxed);
+			const uint32_t Block = Index / EntriesPerBlock;
+			if (Block >= MaxBlocks)
+			{
+				return 0;  ///< Tabla llena: se degrada a nombre vacío en lugar de corromper memoria.
+			}
+			const char* Stored = StoreString(Str);
+
+			Entry* Entries = Blocks[Block].load(std::memory_order_relaxed);
+			if (Entries == nullptr)
+			{
+				Entries = new Entry[EntriesPerBlock];
+				Blocks[Block].store(Entries, std::memory_order_release);
+			}
+			Entries[Index % EntriesPerBlock] = Entry{ Stored, static_cast<uint32_t>(Str.size()) };
+			Count.store(Index + 1, std::memory_order_release);
+
+			Lookup.emplace(std::string_view(Stored, Str.size()), Index);
+			return Index;
+		}
+
+		/**
+		 * @brief Resuelve un índice a su entrada sin tomar locks.
+		 *
+		 * @param Index Índice devuelto previamente por Intern().
+		 * @return Entrada con la cadena y su longitud.
+		 */
+		const Entry& Resolve(uint32_t Index) const
+		{
+			const Entry* Entries = Blocks[Index / EntriesPerBlock].load(std::memory_order_acquire);
+			return Entries[Index % EntriesPerBlock];
+		}
+
+		/**
+		 * @brief Número de cadenas distintas internadas, incluida la vacía.
+		 */
+		size_t Num() const
+		{
+			return Count.load(std::memory_order_acquire);
+		}
+
+		/**
+		 * @brief Bytes reservados para almacenar el texto de las cadenas.
+		 */
+		size_t GetStringBytes() const
+		{
+			std::shared_lock<std::shared_mutex> ReadLock(Mutex);
+			return StringBytes;
+		}
+
+		TNameTable(const TNameTable&) = delete;
+		TNameTable& operator=(const TNameTable&) = delete;
+
+	private:
+		static constexpr uint32_t EntriesPerBlock = 4096;     ///< Entradas por bloque del índice.
+		static constexpr uint32_t MaxBlocks = 1024;           ///< Hasta ~4 millones de nombres distintos.
+		static constexpr size_t StringBlockSize = 64 * 1024;  ///< Tamaño de cada bloque de texto.
+
+		TNameTable()
+		{
+			for (uint32_t i = 0; i < MaxBlocks; ++i)
+			{
+				Blocks[i].store(nullptr, std::memory_order_relaxed);
+			}
+			Entry* First = new Entry[EntriesPerBlock];
+			First[0] = Entry{ "", 0 };
+			Blocks[0].store(First, std::memory_order_release);
+			Count.store(1, std::memory_order_release);
+		}
+
+		~TNameTable()
+		{
+			for (uint32_t i = 0; i < MaxBlocks; ++i)
+			{
+				delete[] Blocks[i].load(std::memory_order_relaxed);
+			}
+			for (char* Block : StringBlocks)
+			{
+				delete[] Block;
+			}
+		}
+
+		/**
+		 * @brief Copia la cadena a un bloque de texto estable. Requiere el lock de escritura.
+		 */
+		const char* StoreString(std::string_view Str)
+		{
+			const size_t Needed = Str.size() + 1;
+			if (Needed > StringBlockSize)
+			{
+				char* Big = new char[Needed];
+				StringBlocks.push_back(Big);
+				StringBytes += Needed;
+				std::memcpy(Big, Str.data(), Str.size());
+				Big[Str.size()] = '\0';
+				return Big;
+			}
+			if (Needed > Remaining)
+			{
+				Cursor = new char[StringBlockSize];
+				StringBlocks.push_back(Cursor);
+				StringBytes += StringBlockSize;
+				Remaining = StringBlockSize;
+			}
+			char* Dest = Cursor;
+			std::memcpy(Dest, Str.data(), Str.size());
+			Dest[Str.size()] = '\0';
+			Cursor += Needed;
+			Remaining -= Needed;
+			return Dest;
+		}
+
+		std::atomic<Entry*> Blocks[MaxBlocks];                    ///< Índice segmentado de entradas.
+		std::atomic<uint32_t> Count;                              ///< Número de entradas publicadas.
+		mutable std::shared_mutex Mutex;                          ///< Protege Lookup y los bloques de texto.
+		std::unordered_map<std::string_view, uint32_t> Lookup;    ///< Cadena -> índice.
+		std::vector<char*> StringBlocks;                          ///< Bloques de texto reservados.
+		char* Cursor = nullptr;                                   ///< Siguiente byte libre del bloque actual.
+		size_t Remaining = 0;                                     ///< Bytes libres en el bloque actual.
+		size_t StringBytes = 0;                                   ///< Total de bytes de texto reservados.
+	};
+
+	/**
+	 * @brief Identificador de nombre internado de 32 bits.
+	 *
+	 * TName sustituye a std::string para nombres de actores, mallas y componentes. Copiar,
+	 * comparar y hashear un TName cuesta lo mismo que un entero, y c_str() devuelve un puntero
+	 * a la cadena internada sin copiarla. Construir un TName desde texto consulta la tabla global
+	 * una sola vez; el resto de operaciones no la tocan.
+	 */
+	class TName
+	{
+	public:
+		/**
+		 * @brief Constructor por defecto: nombre vacío (índice 0).
+		 */
+		TName() : Index(0) {}
+
+		/**
+		 * @brief Construye un nombre internando la cadena indicada.
+		 *
+		 * @param Str Cadena terminada en nulo. nullptr equivale a un nombre vacío.
+		 */
+		TName(const char* Str) : Index(Str ? TNameTable::Get().Intern(std::string_view(Str)) : 0) {}
+
+		/**
+		 * @brief Construye un nombre internando la cadena indicada.
+		 *
+		 * @param Str Cadena a internar.
+		 */
+		TName(const std::string& Str) : Index(TNameTable::Get().Intern(std::string_view(Str))) {}
+
+		/**
+		 * @brief Construye un nombre internando la vista indicada.
+		 *
+		 * @param Str Vista de la cadena a internar.
+		 */
+		explicit TName(std::string_view Str) : Index(TNameTable::Get().Intern(Str)) {}
+
+		/**
+		 * @brief Cadena internada, válida durante toda la ejecución.
+		 */
+		const char* c_str() const { return TNameTable::Get().Resolve(Index).Str; }
+
+		/**
+		 * @brief Longitud de la cadena internada en bytes.
+		 */
+		size_t length() const { return TNameTable::Get().Resolve(Index).Length; }
+
+		/**
+		 * @brief Vista de la cadena internada, sin copias.
+		 */
+		std::string_view view() const
+		{
+			const TNameTable::Entry& E = TNameTable::Get().Resolve(Index);
+			return std::string_view(E.Str, E.Length);
+		}
+
+		/**
+		 * @brief Copia la cadena a un std::string. Reserva memoria; evitar en bucles por frame.
+		 */
+		std::string toString() const { return std::string(view()); }
+
+		/**
+		 * @brief Indica si el nombre está vacío.
+		 */
+		bool isNone() const { return Index == 0; }
+
+		/**
+		 * @brief Índice del nombre en la tabla global.
+		 */
+		uint32_t getIndex() const { return Index; }
+
+		/**
+		 * @brief Hash del nombre: el propio índice, único por cadena.
+		 */
+		size_t getHash() const { return Index; }
+
+		bool operator==(const TName& Other) const { return Index == Other.Index; }
+		bool operator!=(const TName& Other) const { return Index != Other.Index; }
+
+		/**
+		 * @brief Orden por índice (orden de creación), no alfabético. Útil para contenedores ordenados.
+		 */
+		bool operator<(const TName& Other) const { return Index < Other.Index; }
+
+	private:
+		uint32_t Index; ///< Índice de la cadena en TNameTable.
+	};
+
+	// EXAMPLE
+
+	/*
+	int main()
+	{
+		EU::TName A("Fox");
+		EU::TName B(std::string("Fox"));
+
+		std::cout << (A == B) << std::endl;              // 1: misma entrada, comparación entera
+		std::cout << A.c_str() << std::endl;             // "Fox" sin copiar
+		std::cout << sizeof(EU::TName) << std::endl;     // 4
+
+		return 0;
+	}
+	*/
+}
+
+namespace std {
+	template<>
+	struct hash<EU::TName>
+	{
+		size_t operator()(const EU::TName& Name) const noexcept { return Name.getHash(); }
+	};
+}
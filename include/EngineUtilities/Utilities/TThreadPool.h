@@ -0,0 +1,226 @@
+﻿/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace EU {
+	/**
+	 * @brief Grupo de hilos trabajadores para repartir bucles entre núcleos.
+	 *
+	 * parallelFor() divide un rango de índices en trozos de tamaño grain que los trabajadores y
+	 * el propio hilo que llama van tomando con un contador atómico, y no vuelve hasta que se han
+	 * procesado todos. El trabajo se pasa como puntero a la función y a su contexto, sin
+	 * std::function, así que lanzar un bucle no pide memoria al heap y puede hacerse cada frame.
+	 *
+	 * Si parallelFor() se llama desde dentro de otro bucle (anidado), el rango se ejecuta entero
+	 * en ese hilo en lugar de bloquear el grupo.
+	 */
+	class TThreadPool
+	{
+	public:
+		/**
+		 * @brief Número de trabajadores por defecto: un núcleo lo ocupa el hilo que llama.
+		 */
+		static size_t getDefaultWorkerCount()
+		{
+			unsigned int cores = std::thread::hardware_concurrency();
+			return cores > 1 ? cores - 1 : 0;
+		}
+
+		/**
+		 * @brief Arranca los trabajadores.
+		 * @param workerCount Hilos además del que llama a parallelFor(); con 0 todo es secuencial.
+		 */
+		explicit TThreadPool(size_t workerCount = getDefaultWorkerCount())
+		{
+			workers.reserve(workerCount);
+			for (size_t i = 0; i < workerCount; ++i)
+				workers.emplace_back([this]() { workerLoop(); });
+		}
+
+		~TThreadPool()
+		{
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				stopping = true;
+			}
+			wake.notify_all();
+			for (std::thread& worker : workers)
+				worker.join();
+		}
+
+		TThreadPool(const TThreadPool&) = delete;
+		TThreadPool& operator=(const TThreadPool&) = delete;
+
+		/**
+		 * @brief Hilos trabajadores (sin contar el que llama).
+		 */
+		size_t getWorkerCount() const { return workers.size(); }
+
+		/**
+		 * @brief Ejecuta func(begin, end) sobre trozos disjuntos de [0, count) y espera a que terminen.
+		 *
+		 * @param count Número de índices.
+		 * @param grain Índices por trozo; trozos más grandes reducen la contención del contador.
+		 * @param func Invocable con firma void(size_t begin, size_t end).
+		 */
+		template<typename Func>
+		void parallelFor(size_t count, size_t grain, Func&& func)
+		{
+			if (count == 0)
+				return;
+			grain = (std::max)(grain, size_t(1));
+			if (workers.empty() || count <= grain || insideJob())
+			{
+				func(size_t(0), count);
+				return;
+			}
+
+			using FuncType = typename std::remove_reference<Func>::type;
+			std::lock_guard<std::mutex> submitLock(submitMutex);
+			job.context = const_cast<void*>(static_cast<const void*>(&func));
+			job.invoke = [](void* context, size_t begin, size_t end) {
+				(*static_cast<FuncType*>(context))(begin, end);
+			};
+			job.count = count;
+			job.grain = grain;
+			job.next.store(0, std::memory_order_relaxed);
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				active = workers.size();
+				++generation;
+			}
+			wake.notify_all();
+
+			insideJob() = true;
+			runJob();
+			insideJob() = false;
+
+			std::unique_lock<std::mutex> lock(mutex);
+			done.wait(lock, [this]() { return active == 0; });
+		}
+
+	private:
+		/**
+		 * @brief Bucle activo en parallelFor().
+		 */
+		struct Job
+		{
+			void* context = nullptr;                                ///< Invocable del usuario.
+			void (*invoke)(void*, size_t, size_t) = nullptr;        ///< Llama a context con un trozo.
+			size_t count = 0;                                       ///< Índices totales.
+			size_t grain = 1;                                       ///< Índices por trozo.
+			std::atomic<size_t> next{ 0 };                          ///< Primer índice sin repartir.
+		};
+
+		/**
+		 * @brief true en los trabajadores y en el hilo que llama mientras ayuda con un bucle.
+		 */
+		static bool& insideJob()
+		{
+			static thread_local bool inside = false;
+			return inside;
+		}
+
+		/**
+		 * @brief Toma trozos del bucle activo hasta que no quedan.
+		 */
+		void runJob()
+		{
+			for (;;)
+			{
+				size_t begin = job.next.fetch_add(job.grain, std::memory_order_relaxed);
+				if (begin >= job.count)
+					return;
+				job.invoke(job.context, begin, (std::min)(begin + job.grain, job.count));
+			}
+		}
+
+		void workerLoop()
+		{
+			insideJob() = true;
+			uint64_t seen = 0;
+			for (;;)
+			{
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+					wake.wait(lock, [&]() { return stopping || generation != seen; });
+					if (stopping)
+						return;
+					seen = generation;
+				}
+
+				runJob();
+
+				std::lock_guard<std::mutex> lock(mutex);
+				if (--active == 0)
+					done.notify_one();
+			}
+		}
+
+		std::vector<std::thread> workers;  ///< Hilos trabajadores.
+		std::mutex submitMutex;            ///< Serializa llamadas a parallelFor() desde varios hilos.
+		std::mutex mutex;                  ///< Protege generation, active y stopping.
+		std::condition_variable wake;      ///< Avisa a los trabajadores de un bucle nuevo.
+		std::condition_variable done;      ///< Avisa al que llama de que terminaron los trabajadores.
+		Job job;                           ///< Bucle activo.
+		uint64_t generation = 0;           ///< Se incrementa con cada bucle lanzado.
+		size_t active = 0;                 ///< Trabajadores que aún no terminaron el bucle activo.
+		bool stopping = false;             ///< El destructor pidió parar.
+	};
+
+	// EXAMPLE
+
+	/*
+	int main()
+	{
+		EU::TThreadPool Pool;                                   // hardware_concurrency() - 1 trabajadores
+
+		std::vector<float> Values(1000000, 1.0f);
+		Pool.parallelFor(Values.size(), 4096, [&Values](size_t Begin, size_t End)
+		{
+			for (size_t i = Begin; i < End; ++i)
+				Values[i] *= 2.0f;
+		});
+
+		std::cout << "workers: " << Pool.getWorkerCount() << " value: " << Values[0] << std::endl;
+
+		return 0;
+	}
+	*/
+}
\ No newline at end of file
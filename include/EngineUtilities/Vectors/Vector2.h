@@ -27,7 +27,7 @@
  * SOFTWARE.
 */
 #pragma once
-#include "Utilities/EngineMath.h"
+#include "EngineUtilities/Utilities/EngineMath.h"
 
 namespace EU {
   /**
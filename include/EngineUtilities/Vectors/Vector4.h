@@ -28,7 +28,7 @@
 */
 #pragma once
 
-#include "Utilities/EngineMath.h"
+#include "EngineUtilities/Utilities/EngineMath.h"
 namespace EU {
   /**
  * @brief A 4D vector class.
@@ -20,13 +20,13 @@ public:
     /**
      * @brief Inicializa el layout de entrada con elementos específicos y datos del vertex shader.
      * @param device Dispositivo DirectX para crear el layout
-     * @param Layout Vector de descriptores de elementos de entrada
+     * @param Layout Vista de los descriptores de elementos de entrada
      * @param VertexShaderData Datos compilados del vertex shader para validación
      * @return Resultado HRESULT de la operación
      */
     HRESULT
     init(Device& device,
-         std::vector<D3D11_INPUT_ELEMENT_DESC>& Layout,
+         EU::TArrayView<const D3D11_INPUT_ELEMENT_DESC> Layout,
          ID3DBlob* VertexShaderData);
 
     void
@@ -14,10 +14,19 @@ class DeviceContext;
 class
 MeshComponent : public Component {
 public:
+    static constexpr ComponentType StaticType = ComponentType::MESH;
+
     MeshComponent() :
-        m_numVertex(0), m_numIndex(0), Component(ComponentType::MESH) {
+        m_numVertex(0), m_numIndex(0), Component(StaticType) {
     }
 
+    MeshComponent(const MeshComponent&) = default;
+    MeshComponent(MeshComponent&&) = default;
+    MeshComponent&
+    operator=(const MeshComponent&) = default;
+    MeshComponent&
+    operator=(MeshComponent&&) = default;
+
     virtual
     ~MeshComponent() = default;
 
@@ -46,15 +55,23 @@ public:
     }
 
     /**
-     * @brief Carga datos de geometría desde vectores de vértices e índices.
-     * @param vertices Vector de vértices con datos completos de geometría
-     * @param indices Vector de índices para definir la topología de la malla
+     * @brief Carga datos de geometría copiándolos desde vistas de vértices e índices.
+     * @param vertices Vista de vértices con datos completos de geometría
+     * @param indices Vista de índices para definir la topología de la malla
+     */
+    void
+    loadMeshData(EU::TArrayView<const SimpleVertex> vertices, EU::TArrayView<const unsigned int> indices);
+
+    /**
+     * @brief Carga datos de geometría tomando posesión de los vectores, sin copiar vértices.
+     * @param vertices Vector de vértices que se mueve a la malla
+     * @param indices Vector de índices que se mueve a la malla
      */
     void
-    loadMeshData(const std::vector<SimpleVertex>& vertices, const std::vector<unsigned int>& indices);
+    loadMeshData(std::vector<SimpleVertex>&& vertices, std::vector<unsigned int>&& indices);
 
 public:
-    std::string m_name; ///< Nombre identificador de la malla
+    EU::TName m_name; ///< Nombre identificador de la malla
     std::vector<SimpleVertex> m_vertex; ///< Vector de datos de vértices
     std::vector<unsigned int> m_index; ///< Vector de índices para topología
     int m_numVertex; ///< Número total de vértices en la malla
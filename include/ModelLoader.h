@@ -72,8 +72,9 @@ private:
     FbxManager* lSdkManager; ///< Manager del SDK FBX para operaciones de carga
     FbxScene* lScene; ///< Escena FBX cargada en memoria
     std::vector<std::string> textureFileNames; ///< Lista de nombres de archivos de textura
+    EU::TStackAllocator m_scratch{1024 * 1024, EU::EMemoryTag::LOADER}; ///< Memoria temporal por malla, se libera al salir de cada ProcessFBXMesh
 
 public:
-    std::string modelName; ///< Nombre del modelo cargado
+    EU::TName modelName; ///< Nombre del modelo cargado
     std::vector<MeshComponent> meshes; ///< Vector de mallas extraídas del modelo
 };
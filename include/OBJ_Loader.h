@@ -463,6 +463,12 @@ namespace objl
 			unsigned int outputIndicator = outputEveryNth;
 #endif
 
+			// Scratch buffers reused across lines so faces and
+			//	attributes don't hit the heap once they reach capacity
+			std::vector<std::string> sattr;
+			std::vector<Vertex> vVerts;
+			std::vector<unsigned int> iIndices;
+
 			std::string curline;
 			while (std::getline(file, curline))
 			{
@@ -538,38 +544,35 @@ namespace objl
 				// Generate a Vertex Position
 				if (algorithm::firstToken(curline) == "v")
 				{
-					std::vector<std::string> spos;
 					Vector3 vpos;
-					algorithm::split(algorithm::tail(curline), spos, " ");
+					algorithm::split(algorithm::tail(curline), sattr, " ");
 
-					vpos.X = std::stof(spos[0]);
-					vpos.Y = std::stof(spos[1]);
-					vpos.Z = std::stof(spos[2]);
+					vpos.X = std::stof(sattr[0]);
+					vpos.Y = std::stof(sattr[1]);
+					vpos.Z = std::stof(sattr[2]);
 
 					Positions.push_back(vpos);
 				}
 				// Generate a Vertex Texture Coordinate
 				if (algorithm::firstToken(curline) == "vt")
 				{
-					std::vector<std::string> stex;
 					Vector2 vtex;
-					algorithm::split(algorithm::tail(curline), stex, " ");
+					algorithm::split(algorithm::tail(curline), sattr, " ");
 
-					vtex.X = std::stof(stex[0]);
-					vtex.Y = std::stof(stex[1]);
+					vtex.X = std::stof(sattr[0]);
+					vtex.Y = std::stof(sattr[1]);
 
 					TCoords.push_back(vtex);
 				}
 				// Generate a Vertex Normal;
 				if (algorithm::firstToken(curline) == "vn")
 				{
-					std::vector<std::string> snor;
 					Vector3 vnor;
-					algorithm::split(algorithm::tail(curline), snor, " ");
+					algorithm::split(algorithm::tail(curline), sattr, " ");
 
-					vnor.X = std::stof(snor[0]);
-					vnor.Y = std::stof(snor[1]);
-					vnor.Z = std::stof(snor[2]);
+					vnor.X = std::stof(sattr[0]);
+					vnor.Y = std::stof(sattr[1]);
+					vnor.Z = std::stof(sattr[2]);
 
 					Normals.push_back(vnor);
 				}
@@ -577,7 +580,7 @@ namespace objl
 				if (algorithm::firstToken(curline) == "f")
 				{
 					// Generate the vertices
-					std::vector<Vertex> vVerts;
+					vVerts.clear();
 					GenVerticesFromRawOBJ(vVerts, Positions, TCoords, Normals, curline);
 
 					// Add Vertices
@@ -588,7 +591,7 @@ namespace objl
 						LoadedVertices.push_back(vVerts[i]);
 					}
 
-					std::vector<unsigned int> iIndices;
+					iIndices.clear();
 
 					VertexTriangluation(iIndices, vVerts);
 
@@ -730,7 +733,8 @@ namespace objl
 			const std::vector<Vector3>& iNormals,
 			std::string icurline)
 		{
-			std::vector<std::string> sface, svert;
+			std::vector<std::string>& sface = faceTokens;
+			std::vector<std::string>& svert = vertTokens;
 			Vertex vVert;
 			algorithm::split(algorithm::tail(icurline), sface, " ");
 
@@ -854,8 +858,9 @@ namespace objl
 				return;
 			}
 
-			// Create a list of vertices
-			std::vector<Vertex> tVerts = iVerts;
+			// Create a list of vertices (reusing the member buffer's capacity)
+			std::vector<Vertex>& tVerts = triVerts;
+			tVerts.assign(iVerts.begin(), iVerts.end());
 
 			while (true)
 			{
@@ -1163,5 +1168,10 @@ namespace objl
 			else
 				return true;
 		}
+
+		// Scratch buffers kept between faces to avoid per-face allocations
+		std::vector<std::string> faceTokens;
+		std::vector<std::string> vertTokens;
+		std::vector<Vertex> triVerts;
 	};
 }
\ No newline at end of file
@@ -17,8 +17,19 @@
 // Third Party Libraries
 #include "EngineUtilities\Memory\TSharedPointer.h"
 #include "EngineUtilities\Memory\TWeakPointer.h"
+#include "EngineUtilities\Memory\TRefPtr.h"
 #include "EngineUtilities\Memory\TStaticPtr.h"
 #include "EngineUtilities\Memory\TUniquePtr.h"
+#include "EngineUtilities\Memory\TLinearArena.h"
+#include "EngineUtilities\Memory\TPoolAllocator.h"
+#include "EngineUtilities\Memory\TMemoryTracker.h"
+#include "EngineUtilities\Memory\TStackAllocator.h"
+#include "EngineUtilities\Memory\TAlignedAllocator.h"
+#include "EngineUtilities\Memory\TTLSFHeap.h"
+#include "EngineUtilities\Memory\TAllocationCounter.h"
+#include "EngineUtilities\Utilities\TName.h"
+#include "EngineUtilities\Utilities\TThreadPool.h"
+#include "EngineUtilities\Structures\TArrayView.h"
 
 // MACROS
 #define SAFE_RELEASE(x) if(x != nullptr) x->Release(); x = nullptr;
@@ -90,5 +101,8 @@ enum
     NONE = 0, ///< Tipo de componente no especificado.
     TRANSFORM = 1, ///< Componente de transformación.
     MESH = 2, ///< Componente de malla.
-    MATERIAL = 3 ///< Componente de material.
+    MATERIAL = 3, ///< Componente de material.
+    SHADOW_CASTER = 4, ///< Marca de entidad que proyecta sombra.
+    MESH_RENDERER = 5, ///< Handles de GPU para dibujar la malla de una entidad.
+    COMPONENT_TYPE_COUNT ///< Número de tipos; cada tipo ocupa un bit de ComponentMask.
 };
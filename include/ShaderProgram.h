@@ -22,13 +22,13 @@ public:
      * @brief Inicializa el programa de shaders completo desde un archivo.
      * @param device Dispositivo DirectX para crear los shaders
      * @param fileName Nombre del archivo que contiene el código de shaders
-     * @param Layout Vector de descriptores para el layout de entrada
+     * @param Layout Vista de los descriptores para el layout de entrada
      * @return Resultado HRESULT de la operación
      */
     HRESULT
     init(Device& device,
          const std::string& fileName,
-         std::vector<D3D11_INPUT_ELEMENT_DESC> Layout);
+         EU::TArrayView<const D3D11_INPUT_ELEMENT_DESC> Layout);
 
     void
     update();
@@ -50,11 +50,11 @@ public:
     /**
      * @brief Crea el layout de entrada para los shaders.
      * @param device Dispositivo DirectX para crear el layout
-     * @param Layout Vector de descriptores de elementos de entrada
+     * @param Layout Vista de los descriptores de elementos de entrada
      * @return Resultado HRESULT de la operación
      */
     HRESULT
-    CreateInputLayout(Device& device, std::vector<D3D11_INPUT_ELEMENT_DESC> Layout);
+    CreateInputLayout(Device& device, EU::TArrayView<const D3D11_INPUT_ELEMENT_DESC> Layout);
 
     /**
      * @brief Crea un shader específico del tipo indicado.
@@ -17,6 +17,23 @@ public:
     Texture() = default;
     ~Texture() = default;
 
+    /**
+     * @brief Las copias comparten los recursos D3D pero no los bytes registrados en el tracker:
+     * solo el original los descuenta en destroy().
+     */
+    Texture(const Texture& other);
+
+    Texture&
+    operator=(const Texture& other);
+
+    /**
+     * @brief Los movimientos traspasan también los bytes registrados en el tracker.
+     */
+    Texture(Texture&& other) noexcept;
+
+    Texture&
+    operator=(Texture&& other) noexcept;
+
     /**
      * @brief Inicializa una textura cargando desde un archivo de imagen.
      * @param device Dispositivo DirectX para crear la textura
@@ -76,4 +93,5 @@ public:
     ID3D11Texture2D* m_texture = nullptr; ///< Recurso de textura 2D como datos en memoria
     ID3D11ShaderResourceView* m_textureFromImg; ///< Vista de recurso de shader para acceso desde shaders
     std::wstring m_textureName; ///< Nombre del archivo de textura cargado
+    size_t m_trackedBytes = 0; ///< Bytes de GPU estimados y registrados en el tracker de memoria
 };
@@ -39,6 +39,13 @@ public:
     void
     update();
 
+    /**
+     * @brief Asigna la arena por frame de la que salen las cadenas y listas temporales de la UI.
+     * @param frameArena Arena propiedad de BaseApp; se reinicia al inicio de cada frame
+     */
+    void
+    setFrameArena(EU::TFrameArena<2>* frameArena);
+
     void
     render();
 
@@ -50,7 +57,7 @@ public:
      * @param columnWidth Ancho de las columnas de entrada
      */
     void
-    vec3Control(const std::string& label,
+    vec3Control(const char* label,
                 float* values,
                 float resetValue = 0.0f,
                 float columnWidth = 100.0f);
@@ -63,7 +70,7 @@ public:
      * @param columnWidth Ancho de la columna de entrada
      */
     void
-    floatControl(const std::string& label,
+    floatControl(const char* label,
                  float* value,
                  float resetValue = 0.0f,
                  float columnWidth = 100.0f);
@@ -90,14 +97,14 @@ public:
      * @param actor Actor seleccionado para inspección
      */
     void
-    inspectorGeneral(EU::TSharedPointer<Actor> actor);
+    inspectorGeneral(const EU::TRefPtr<Actor>& actor);
 
     /**
      * @brief Panel contenedor del inspector con múltiples secciones de propiedades.
      * @param actor Actor seleccionado para inspección detallada
      */
     void
-    inspectorContainer(EU::TSharedPointer<Actor> actor);
+    inspectorContainer(const EU::TRefPtr<Actor>& actor);
 
     /**
      * @brief Ventana de salida para logs, errores y información de depuración.
@@ -112,16 +119,16 @@ public:
     mainMenuBar();
 
     void
-    objectControlPanel(EU::TSharedPointer<Actor> actor);
+    objectControlPanel(const EU::TRefPtr<Actor>& actor);
 
     void
-    transformControls(EU::TSharedPointer<Actor> actor);
+    transformControls(const EU::TRefPtr<Actor>& actor);
 
     void
-    scaleControls(EU::TSharedPointer<Actor> actor);
+    scaleControls(const EU::TRefPtr<Actor>& actor);
 
     void
-    rotationControls(EU::TSharedPointer<Actor> actor);
+    rotationControls(const EU::TRefPtr<Actor>& actor);
 
     std::wstring
     openFileDialog(const wchar_t* filter);
@@ -142,9 +149,9 @@ public:
     visualStudioStyle();
 
     void
-    ToolTip(std::string icon, std::string tip);
+    ToolTip(const char* icon, const char* tip);
     void
-    ToolTip(std::string tip);
+    ToolTip(const char* tip);
 
     void
     toolTipData();
@@ -159,7 +166,7 @@ public:
     RenderFullScreenTransparentWindow();
 
     void
-    outliner(const std::vector<EU::TSharedPointer<Actor>>& actors);
+    outliner(const std::vector<EU::TRefPtr<Actor>>& actors);
 
     void
     lightControlPanel(float position[3]);
@@ -167,6 +174,12 @@ public:
     void
     cameraControlPanel(float* yawDeg, float* pitchDeg, float* distance);
 
+    /**
+     * @brief Panel con la memoria actual, pico, reservas y presupuesto de cada subsistema.
+     */
+    void
+    memoryPanel();
+
 private:
     bool checkboxValue = true;
     bool checkboxValue2 = false;
@@ -179,6 +192,7 @@ private:
     std::wstring selectedFilePath = L"";
     bool showObjectControls = true;
     HWND m_windowHandle = nullptr;
+    EU::TFrameArena<2>* m_frameArena = nullptr; ///< Memoria temporal del frame (no propia)
 
 public:
     int selectedActorIndex = -1;
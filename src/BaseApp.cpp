@@ -1,50 +1,77 @@
 ﻿#include "BaseApp.h"
 #include "ECS/Transform.h"
+#include "ECS/CoreSystems.h"
+
+// Aviso de presupuesto superado; el tracker lo llama una vez cada vez que una etiqueta lo cruza
+static void
+onMemoryBudgetExceeded(EU::EMemoryTag tag, size_t currentBytes, size_t budgetBytes) {
+    ERROR("MemoryTracker", EU::GetMemoryTagName(tag),
+          "Memory budget exceeded: " << currentBytes << " / " << budgetBytes << " bytes");
+}
 
 HRESULT
 BaseApp::init() {
     HRESULT hr = S_OK;
 
+    // Presupuestos por subsistema: al superarlos se avisa por el log y el panel de memoria los marca
+    EU::TMemoryTracker& memoryTracker = EU::TMemoryTracker::get();
+    memoryTracker.setBudgetCallback(&onMemoryBudgetExceeded);
+    memoryTracker.setBudget(EU::EMemoryTag::MESH, 256 * 1024 * 1024);
+    memoryTracker.setBudget(EU::EMemoryTag::TEXTURE, 512 * 1024 * 1024);
+    memoryTracker.setBudget(EU::EMemoryTag::RENDER, 64 * 1024 * 1024);
+    memoryTracker.setBudget(EU::EMemoryTag::ECS, 32 * 1024 * 1024);
+    memoryTracker.setBudget(EU::EMemoryTag::UI, 8 * 1024 * 1024);
+    memoryTracker.setBudget(EU::EMemoryTag::LOADER, 128 * 1024 * 1024);
+
+    // Orden de registro = orden entre sistemas que comparten componentes. Estos tres forman una
+    // cadena (local -> mundo -> buffers del actor) y se ejecutan uno tras otro; el paralelismo
+    // está dentro de cada uno (parallelFor). Un sistema que no toque Transform compartiría nivel
+    m_systems.addSystem<TransformSystem>();
+    m_systems.addSystem<SceneGraphSystem>();
+    m_systems.addSystem<ActorSystem>(m_actors);
+    m_shadowCasters = m_world.query<const MeshRenderer>().with<Transform, ShadowCaster>();
+
     hr = m_swapChain.init(m_device, m_deviceContext, m_backBuffer, m_window);
     if (FAILED(hr)) {
-        ERROR("Main", "InitDevice", ("Failed to initialize SwpaChian. HRESULT: " + std::to_string(hr)).c_str());
+        ERROR("Main", "InitDevice", "Failed to initialize SwpaChian. HRESULT: " << hr);
         return hr;
     }
 
     hr = m_renderTargetView.init(m_device, m_backBuffer, DXGI_FORMAT_R8G8B8A8_UNORM);
     if (FAILED(hr)) {
-        ERROR("Main", "InitDevice", ("Failed to initialize RenderTargetView. HRESULT: " + std::to_string(hr)).c_str());
+        ERROR("Main", "InitDevice", "Failed to initialize RenderTargetView. HRESULT: " << hr);
         return hr;
     }
 
     hr = m_depthStencil.init(m_device, m_window.m_width, m_window.m_height, DXGI_FORMAT_D24_UNORM_S8_UINT,
                              D3D11_BIND_DEPTH_STENCIL, 4, 0);
     if (FAILED(hr)) {
-        ERROR("Main", "InitDevice", ("Failed to initialize DepthStencil. HRESULT: " + std::to_string(hr)).c_str());
+        ERROR("Main", "InitDevice", "Failed to initialize DepthStencil. HRESULT: " << hr);
         return hr;
     }
 
     hr = m_depthStencilView.init(m_device, m_depthStencil, DXGI_FORMAT_D24_UNORM_S8_UINT);
     if (FAILED(hr)) {
-        ERROR("Main", "InitDevice", ("Failed to initialize DepthStencilView. HRESULT: " + std::to_string(hr)).c_str());
+        ERROR("Main", "InitDevice", "Failed to initialize DepthStencilView. HRESULT: " << hr);
         return hr;
     }
 
     hr = m_viewport.init(m_window);
     if (FAILED(hr)) {
-        ERROR("Main", "InitDevice", ("Failed to initialize Viewport. HRESULT: " + std::to_string(hr)).c_str());
+        ERROR("Main", "InitDevice", "Failed to initialize Viewport. HRESULT: " << hr);
         return hr;
     }
 
-    std::vector<D3D11_INPUT_ELEMENT_DESC> Layout;
-    Layout.push_back({"POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT,
-                      D3D11_INPUT_PER_VERTEX_DATA, 0});
-    Layout.push_back({"TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT,
-                      D3D11_INPUT_PER_VERTEX_DATA, 0});
+    D3D11_INPUT_ELEMENT_DESC Layout[] = {
+        {"POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT,
+         D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT,
+         D3D11_INPUT_PER_VERTEX_DATA, 0},
+    };
 
     hr = m_shaderProgram.init(m_device, "HybridEngine.fx", Layout);
     if (FAILED(hr)) {
-        ERROR("Main", "InitDevice", ("Failed to initialize ShaderProgram. HRESULT: " + std::to_string(hr)).c_str());
+        ERROR("Main", "InitDevice", "Failed to initialize ShaderProgram. HRESULT: " << hr);
         return hr;
     }
 
@@ -54,7 +81,7 @@ BaseApp::init() {
     // ===================================================================================
 
     // Set Plane Actor (Esta parte se mantiene)
-    m_APlane = EU::MakeShared<Actor>(m_device);
+    m_APlane = EU::MakeRef<Actor>(m_world, m_device);
     if (!m_APlane.isNull()) {
         SimpleVertex planeVertices[] = {
             {XMFLOAT3(-20.0f, 0.0f, -20.0f), XMFLOAT2(0.0f, 0.0f)},
@@ -62,28 +89,21 @@ BaseApp::init() {
             {XMFLOAT3(20.0f, 0.0f, 20.0f), XMFLOAT2(1.0f, 1.0f)},
             {XMFLOAT3(-20.0f, 0.0f, 20.0f), XMFLOAT2(0.0f, 1.0f)},
         };
-        WORD planeIndices[] = {0, 2, 1, 0, 3, 2};
+        unsigned int planeIndices[] = {0, 2, 1, 0, 3, 2};
 
-        planeMesh.m_vertex.assign(planeVertices, planeVertices + 4);
-        planeMesh.m_index.assign(planeIndices, planeIndices + 6);
-        planeMesh.m_numVertex = 4;
-        planeMesh.m_numIndex = 6;
+        planeMesh.loadMeshData(planeVertices, planeIndices);
 
         hr = m_PlaneTexture.init(m_device, L"Textures/Wood.dds", DDS);
         if (FAILED(hr)) {
-            ERROR("Main", "InitDevice", ("Failed to initialize Plane Texture. HRESULT: " + std::to_string(hr)).c_str());
+            ERROR("Main", "InitDevice", "Failed to initialize Plane Texture. HRESULT: " << hr);
             return hr;
         }
 
-        std::vector<MeshComponent> PlaneMeshes;
-        PlaneMeshes.push_back(planeMesh);
-        std::vector<Texture> PlaneTextures;
-        PlaneTextures.push_back(m_PlaneTexture);
-
-        m_APlane->setMesh(m_device, PlaneMeshes);
-        m_APlane->setTextures(PlaneTextures);
+        m_APlane->setMesh(m_device, EU::MakeArrayView(&planeMesh, 1));
+        m_APlane->setTextures(EU::MakeArrayView(&m_PlaneTexture, 1));
         m_APlane->getComponent<Transform>()->setTransform(EU::Vector3(0.0f, -5.0f, 0.0f), EU::Vector3(0.0f, 0.0f, 0.0f),
                                                           EU::Vector3(1.0f, 1.0f, 1.0f));
+        m_APlane->setName("Plane");
         m_APlane->setCastShadow(false);
         m_APlane->setReceiveShadow(true);
         m_actors.push_back(m_APlane);
@@ -111,37 +131,45 @@ BaseApp::init() {
     m_LightPos = XMFLOAT4(2.0f, 4.0f, -2.0f, 1.0f);
 
     m_userInterface.init(m_window.m_hWnd, m_device.m_device, m_deviceContext.m_deviceContext);
+    m_frameArena.init(256 * 1024, EU::EMemoryTag::UI);
+    m_userInterface.setFrameArena(&m_frameArena);
 
     // Initialize shadow mapping resources
     const unsigned int shadowSize = 1024;
     hr = m_shadowTexture.init(m_device, shadowSize, shadowSize, DXGI_FORMAT_R24G8_TYPELESS,
                               D3D11_BIND_DEPTH_STENCIL | D3D11_BIND_SHADER_RESOURCE, 1, 0);
     if (FAILED(hr)) {
-        ERROR("Main", "InitDevice", ("Failed to create shadow depth texture. HRESULT: " + std::to_string(hr)).c_str());
+        ERROR("Main", "InitDevice", "Failed to create shadow depth texture. HRESULT: " << hr);
         return hr;
     }
 
     hr = m_shadowDSV.init(m_device, m_shadowTexture, DXGI_FORMAT_D24_UNORM_S8_UINT);
     if (FAILED(hr)) {
-        ERROR("Main", "InitDevice", ("Failed to create shadow DSV. HRESULT: " + std::to_string(hr)).c_str());
+        ERROR("Main", "InitDevice", "Failed to create shadow DSV. HRESULT: " << hr);
         return hr;
     }
 
     hr = m_shadowSRVTexture.init(m_device, m_shadowTexture, DXGI_FORMAT_R24_UNORM_X8_TYPELESS);
     if (FAILED(hr)) {
-        ERROR("Main", "InitDevice", ("Failed to create shadow SRV. HRESULT: " + std::to_string(hr)).c_str());
+        ERROR("Main", "InitDevice", "Failed to create shadow SRV. HRESULT: " << hr);
         return hr;
     }
 
     hr = m_shadowViewport.init(shadowSize, shadowSize);
     if (FAILED(hr)) {
-        ERROR("Main", "InitDevice", ("Failed to initialize shadow viewport. HRESULT: " + std::to_string(hr)).c_str());
+        ERROR("Main", "InitDevice", "Failed to initialize shadow viewport. HRESULT: " << hr);
+        return hr;
+    }
+
+    hr = m_shadowRasterizer.init(m_device);
+    if (FAILED(hr)) {
+        ERROR("Main", "InitDevice", "Failed to create shadow rasterizer. HRESULT: " << hr);
         return hr;
     }
 
     hr = m_lightBuffer.init(m_device, sizeof(CBLight));
     if (FAILED(hr)) {
-        ERROR("Main", "InitDevice", ("Failed to create light constant buffer. HRESULT: " + std::to_string(hr)).c_str());
+        ERROR("Main", "InitDevice", "Failed to create light constant buffer. HRESULT: " << hr);
         return hr;
     }
 
@@ -149,6 +177,8 @@ BaseApp::init() {
     // CÓDIGO ACTUALIZADO: Conexión del callback con normalización de escala.
     // ===================================================================================
     m_userInterface.onImportModel = [this](const std::wstring& modelPath, const std::wstring& texturePath) {
+        // Importar reserva memoria por diseño; el control de frames sin reservas vuelve a calentar
+        m_steadyFrames = 0;
         ModelLoader fbxLoader;
         // 1. Cargar el modelo FBX (sin cambios)
         std::string modelPathStr(modelPath.begin(), modelPath.end());
@@ -184,23 +214,16 @@ BaseApp::init() {
             scaleFactor = TARGET_SIZE / largestDimension;
         }
 
-        // 4. Crear nuevas mallas con los vértices centrados y re-escalados
-        std::vector<MeshComponent> normalizedMeshes;
-        for (const auto& originalMesh : fbxLoader.meshes) {
-            MeshComponent newMesh = originalMesh; // Copiar metadatos
-            newMesh.m_vertex.clear();
-
-            for (const auto& originalVertex : originalMesh.m_vertex) {
-                SimpleVertex newVertex = originalVertex;
-                XMVECTOR originalPos = XMLoadFloat3(&originalVertex.Pos);
+        // 4. Centrar y re-escalar los vértices en su lugar; las mallas del loader no se copian
+        for (auto& mesh : fbxLoader.meshes) {
+            for (auto& vertex : mesh.m_vertex) {
+                XMVECTOR originalPos = XMLoadFloat3(&vertex.Pos);
 
                 // Aplicar la transformación: Centrar y luego escalar
                 XMVECTOR newPos = (originalPos - center) * scaleFactor;
 
-                XMStoreFloat3(&newVertex.Pos, newPos);
-                newMesh.m_vertex.push_back(newVertex);
+                XMStoreFloat3(&vertex.Pos, newPos);
             }
-            normalizedMeshes.push_back(newMesh);
         }
 
         // 4.1 Calcular la base (minY) del modelo ya normalizado para ubicarlo sobre el piso
@@ -211,21 +234,14 @@ BaseApp::init() {
         const float epsilon = 0.01f; // pequeño desplazamiento sobre el piso
         float placeY = floorY - minYNormalized + epsilon;
 
-        // 5. Crear y configurar el Actor con la malla normalizada
-        EU::TSharedPointer<Actor> newActor = EU::MakeShared<Actor>(m_device);
-        if (newActor.isNull()) {
-            ERROR("BaseApp", "onImportModel", "Failed to create new Actor.");
-            return;
-        }
-
+        // 5. Cargar las texturas del modelo
         std::vector<Texture> textures;
         if (!texturePath.empty()) {
             Texture newTexture;
             if (SUCCEEDED(newTexture.init(m_device, texturePath, DDS))) {
                 textures.push_back(newTexture);
             } else {
-                std::string texturePathStr(texturePath.begin(), texturePath.end());
-                ERROR("BaseApp", "onImportModel", ("FALLO AL INICIALIZAR LA TEXTURA DDS: " + texturePathStr).c_str());
+                ERROR("BaseApp", "onImportModel", "FALLO AL INICIALIZAR LA TEXTURA DDS: " << texturePath);
             }
         } else {
             // Textura por defecto si el usuario no selecciona una
@@ -237,18 +253,33 @@ BaseApp::init() {
             }
         }
 
-        newActor->setMesh(m_device, normalizedMeshes); // Usar las mallas normalizadas
-        newActor->setTextures(textures);
+        // 6. Crear y configurar el Actor en el punto de sincronización del frame: crear la entidad
+        //    y añadirla a m_actors mientras los sistemas recorren el mundo no es seguro
+        m_commands.getBuffer().defer([this,
+                                      name = fbxLoader.modelName,
+                                      meshes = std::move(fbxLoader.meshes),
+                                      textures = std::move(textures),
+                                      placeY](World& world) mutable {
+            EU::TRefPtr<Actor> newActor = EU::MakeRef<Actor>(world, m_device);
+            if (newActor.isNull()) {
+                ERROR("BaseApp", "onImportModel", "Failed to create new Actor.");
+                return;
+            }
+
+            newActor->setName(name);
+            newActor->setMesh(m_device, std::move(meshes)); // Mallas ya normalizadas
+            newActor->setTextures(std::move(textures));
 
-        // La escala ahora es (1, 1, 1) porque el modelo base ya está en el tamaño correcto
-        newActor->getComponent<Transform>()->setTransform(
-            EU::Vector3(0.0f, placeY, 0.0f), // Base del modelo ligeramente sobre el piso
-            EU::Vector3(0.0f, 0.0f, 0.0f), // Rotación
-            EU::Vector3(1.0f, 1.0f, 1.0f)); // Escala
+            // La escala ahora es (1, 1, 1) porque el modelo base ya está en el tamaño correcto
+            newActor->getComponent<Transform>()->setTransform(
+                EU::Vector3(0.0f, placeY, 0.0f), // Base del modelo ligeramente sobre el piso
+                EU::Vector3(0.0f, 0.0f, 0.0f), // Rotación
+                EU::Vector3(1.0f, 1.0f, 1.0f)); // Escala
 
-        newActor->setCastShadow(true);
-        newActor->setReceiveShadow(false); // Evitar auto-sombra en el propio FBX
-        m_actors.push_back(newActor);
+            newActor->setCastShadow(true);
+            newActor->setReceiveShadow(false); // Evitar auto-sombra en el propio FBX
+            m_actors.push_back(newActor);
+        });
     };
 
     return S_OK;
@@ -256,6 +287,16 @@ BaseApp::init() {
 
 void
 BaseApp::update() {
+    // Punto de sincronización: los cambios estructurales grabados en el frame anterior
+    // (importaciones desde la UI, comandos de los sistemas) se aplican antes que nada
+    m_commands.playback(m_world);
+
+    // Lo reservado hace dos frames ya no lo usa nadie; el frame anterior sigue intacto
+    m_frameArena.beginFrame();
+
+    // Totales de todo el proceso para el panel de memoria; la comprobación del frame está en run()
+    EU::TAllocationCounter::get().beginFrame();
+
     m_userInterface.update();
 
     // Asegurarse de que el índice seleccionado sea válido para el vector de actores
@@ -272,6 +313,7 @@ BaseApp::update() {
 
     // Camera controls UI
     m_userInterface.cameraControlPanel(&m_camYawDeg, &m_camPitchDeg, &m_camDistance);
+    m_userInterface.memoryPanel();
 
     static float t = 0.0f;
     static DWORD dwTimeStart = 0;
@@ -315,9 +357,14 @@ BaseApp::update() {
     cbLight.LightPos = m_LightPos;
     m_lightBuffer.update(m_deviceContext, nullptr, 0, nullptr, &cbLight, 0, 0);
 
+    // Transform -> jerarquía -> parte de CPU de los actores (ver CoreSystems)
+    m_systems.run(m_world, t);
+
+    // La subida a la GPU queda en este hilo porque el contexto inmediato de D3D11 no admite
+    // llamadas concurrentes
     for (auto& actor : m_actors) {
         if (!actor.isNull()) {
-            actor->update(t, m_deviceContext);
+            actor->uploadGPU(m_deviceContext);
         }
     }
 }
@@ -349,12 +396,23 @@ BaseApp::render() {
     m_shaderProgram.render(m_deviceContext, VERTEX_SHADER);
     m_deviceContext.PSSetShader(nullptr, nullptr, 0);
 
-    // Draw only shadow casters
-    for (auto& actor : m_actors) {
-        if (!actor.isNull() && actor->canCastShadow()) {
-            actor->render(m_deviceContext);
+    // Draw only shadow casters: la consulta recorre los MeshRenderer de las entidades con
+    // ShadowCaster en orden de chunk, sin pasar por los Actor
+    m_shadowRasterizer.render(m_deviceContext);
+    m_deviceContext.IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    m_shadowCasters.each([this](const MeshRenderer& renderer) {
+        if (!renderer.modelBuffer) {
+            return;
         }
-    }
+        m_deviceContext.VSSetConstantBuffers(2, 1, &renderer.modelBuffer);
+        for (unsigned int i = 0; i < renderer.drawCount; ++i) {
+            const MeshDraw& draw = renderer.draws[i];
+            const unsigned int offset = 0;
+            m_deviceContext.IASetVertexBuffers(0, 1, &draw.vertexBuffer, &draw.stride, &offset);
+            m_deviceContext.IASetIndexBuffer(draw.indexBuffer, DXGI_FORMAT_R32_UINT, 0);
+            m_deviceContext.DrawIndexed(draw.indexCount, 0, 0);
+        }
+    });
 
     // Restore camera matrices in constant buffers
     cbNeverChanges.mView = viewBackup;
@@ -402,11 +460,15 @@ BaseApp::destroy() {
         }
     }
     m_actors.clear();
+    // El plano se libera aquí y no en el destructor estático de BaseApp, cuando la caché del pool
+    // de actores del hilo principal puede haberse destruido ya
+    m_APlane.reset();
 
     // Destroy shadow resources
     m_shadowSRVTexture.destroy();
     m_shadowDSV.destroy();
     m_shadowTexture.destroy();
+    m_shadowRasterizer.destroy();
     m_lightBuffer.destroy();
 
     m_neverChanges.destroy();
@@ -423,6 +485,29 @@ BaseApp::destroy() {
         m_device.m_device->Release();
 }
 
+bool
+BaseApp::checkFrameAllocations(const EU::AllocationCounts& frameAllocations) {
+    const unsigned int allocationWarmupFrames = 60;
+    if (m_steadyFrames < allocationWarmupFrames) {
+        ++m_steadyFrames;
+        return true;
+    }
+    if (frameAllocations.allocations == 0) {
+        return true;
+    }
+
+    // En Release se avisa una sola vez para no inundar el log; en Debug falla cada frame
+    if (!m_reportedFrameAllocations) {
+        ERROR("BaseApp", "checkFrameAllocations", "Steady-state frame allocated " << frameAllocations.allocations
+              << " times (" << frameAllocations.bytes << " bytes)");
+        m_reportedFrameAllocations = true;
+    }
+#if defined(_DEBUG)
+    assert(!"Steady-state frame allocated heap memory");
+#endif
+    return false;
+}
+
 int
 BaseApp::run(HINSTANCE hInstance,
              HINSTANCE hPrevInstance,
@@ -447,8 +532,11 @@ BaseApp::run(HINSTANCE hInstance,
             TranslateMessage(&msg);
             DispatchMessage(&msg);
         } else {
+            // Solo cuenta lo que reserva este hilo: los trabajadores del pool llevan sus propios contadores
+            EU::TAllocationScope frameScope;
             update();
             render();
+            checkFrameAllocations(frameScope.getCounts());
         }
     }
 
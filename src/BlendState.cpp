@@ -28,7 +28,7 @@ BlendState::init(Device& device) {
     HRESULT hr = device.m_device->CreateBlendState(&blendDesc, &m_blendState);
     if (FAILED(hr)) {
         ERROR("BlendState", "init",
-              ("Failed to create blend state. HRESULT: " + std::to_string(hr)).c_str());
+              "Failed to create blend state. HRESULT: " << hr);
         return hr;
     }
     return S_OK;
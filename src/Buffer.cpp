@@ -122,8 +122,18 @@ Buffer::render(DeviceContext& deviceContext,
 
 }
 
+EU::EMemoryTag
+Buffer::memoryTag() const {
+    return (m_bindFlag & (D3D11_BIND_VERTEX_BUFFER | D3D11_BIND_INDEX_BUFFER)) ? EU::EMemoryTag::MESH
+                                                                                : EU::EMemoryTag::RENDER;
+}
+
 void
 Buffer::destroy() {
+    if (m_buffer && m_trackedBytes) {
+        EU::TMemoryTracker::get().recordFree(memoryTag(), m_trackedBytes);
+        m_trackedBytes = 0;
+    }
     SAFE_RELEASE(m_buffer);
 }
 
@@ -142,5 +152,7 @@ Buffer::createBuffer(Device& device,
         ERROR("Buffer", "createBuffer", "Failed to create buffer");
         return hr;
     }
+    m_trackedBytes = desc.ByteWidth;
+    EU::TMemoryTracker::get().recordAlloc(memoryTag(), m_trackedBytes);
     return S_OK;
 }
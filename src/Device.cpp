@@ -27,7 +27,7 @@ Device::CreateRenderTargetView(ID3D11Resource* pResource,
                 "Render Target View created successfully!");
     } else {
         ERROR("Device", "CreateRenderTargetView",
-              ("Failed to create Render Target View. HRESULT: " + std::to_string(hr)).c_str());
+              "Failed to create Render Target View. HRESULT: " << hr);
     }
 
     return hr;
@@ -55,7 +55,7 @@ Device::CreateTexture2D(const D3D11_TEXTURE2D_DESC* pDesc,
                 "Texture2D created successfully!");
     } else {
         ERROR("Device", "CreateTexture2D",
-              ("Failed to create Texture2D. HRESULT: " + std::to_string(hr)).c_str());
+              "Failed to create Texture2D. HRESULT: " << hr);
     }
 
     return hr;
@@ -83,7 +83,7 @@ Device::CreateDepthStencilView(ID3D11Resource* pResource,
                 "Depth Stencil View created successfully!");
     } else {
         ERROR("Device", "CreateDepthStencilView",
-              ("Failed to create Depth Stencil View. HRESULT: " + std::to_string(hr)).c_str());
+              "Failed to create Depth Stencil View. HRESULT: " << hr);
     }
 
     return hr;
@@ -115,7 +115,7 @@ Device::CreateVertexShader(const void* pShaderBytecode,
                 "Vertex Shader created successfully!");
     } else {
         ERROR("Device", "CreateVertexShader",
-              ("Failed to create Vertex Shader. HRESULT: " + std::to_string(hr)).c_str());
+              "Failed to create Vertex Shader. HRESULT: " << hr);
     }
 
     return hr;
@@ -149,7 +149,7 @@ Device::CreateInputLayout(const D3D11_INPUT_ELEMENT_DESC* pInputElementDescs,
                 "Input Layout created successfully!");
     } else {
         ERROR("Device", "CreateInputLayout",
-              ("Failed to create Input Layout. HRESULT: " + std::to_string(hr)).c_str());
+              "Failed to create Input Layout. HRESULT: " << hr);
     }
 
     return hr;
@@ -181,7 +181,7 @@ Device::CreatePixelShader(const void* pShaderBytecode,
                 "Pixel Shader created successfully!");
     } else {
         ERROR("Device", "CreatePixelShader",
-              ("Failed to create Pixel Shader. HRESULT: " + std::to_string(hr)).c_str());
+              "Failed to create Pixel Shader. HRESULT: " << hr);
     }
 
     return hr;
@@ -208,7 +208,7 @@ Device::CreateSamplerState(const D3D11_SAMPLER_DESC* pSamplerDesc,
                 "Sampler State created successfully!");
     } else {
         ERROR("Device", "CreateSamplerState",
-              ("Failed to create Sampler State. HRESULT: " + std::to_string(hr)).c_str());
+              "Failed to create Sampler State. HRESULT: " << hr);
     }
 
     return hr;
@@ -236,7 +236,7 @@ Device::CreateBuffer(const D3D11_BUFFER_DESC* pDesc,
                 "Buffer created successfully!");
     } else {
         ERROR("Device", "CreateBuffer",
-              ("Failed to create Buffer. HRESULT: " + std::to_string(hr)).c_str());
+              "Failed to create Buffer. HRESULT: " << hr);
 
     }
     return hr;
@@ -263,7 +263,7 @@ Device::CreateBlendState(const D3D11_BLEND_DESC* pBlendStateDesc,
                 "Blend State created successfully!");
     } else {
         ERROR("Device", "CreateBlendState",
-              ("Failed to create Blend State. HRESULT: " + std::to_string(hr)).c_str());
+              "Failed to create Blend State. HRESULT: " << hr);
     }
     return hr;
 }
@@ -289,7 +289,7 @@ Device::CreateDepthStencilState(const D3D11_DEPTH_STENCIL_DESC* pDepthStencilDes
                 "Depth Stencil State created successfully!");
     } else {
         ERROR("Device", "CreateDepthStencilState",
-              ("Failed to create Depth Stencil State. HRESULT: " + std::to_string(hr)).c_str());
+              "Failed to create Depth Stencil State. HRESULT: " << hr);
     }
 
     return hr;
@@ -316,7 +316,7 @@ Device::CreateRasterizerState(const D3D11_RASTERIZER_DESC* pRasterizerDesc,
                 "Rasterizer State created successfully!");
     } else {
         ERROR("Device", "CreateRasterizerState",
-              ("Failed to create Rasterizer State. HRESULT: " + std::to_string(hr)).c_str());
+              "Failed to create Rasterizer State. HRESULT: " << hr);
     }
 
     return hr;
@@ -3,53 +3,55 @@
 #include "Device.h"
 #include "DeviceContext.h"
 
-Actor::Actor(Device& device) {
+Actor::Actor(World& world, Device& device) :
+	Entity(world) {
 	// Setup Default Components
-	EU::TSharedPointer<Transform> transform = EU::MakeShared<Transform>();
-	addComponent(transform);
-	EU::TSharedPointer<MeshComponent> meshComponent = EU::MakeShared<MeshComponent>();
-	addComponent(meshComponent);
+	Transform* transform = addComponent<Transform>();
+	transform->setSceneNode(&world.getSceneGraph(), world.getSceneGraph().createNode());
+	addComponent<MeshComponent>();
+	addComponent<ShadowCaster>();
 
 	HRESULT hr;
-	std::string classNameType = "Actor -> " + m_name;
 	hr = m_modelBuffer.init(device, sizeof(CBChangesEveryFrame));
 	if (FAILED(hr)) {
-		ERROR("Actor", classNameType.c_str(), "Failed to create new CBChangesEveryFrame");
+		ERROR("Actor", "Actor -> " << m_name.c_str(), "Failed to create new CBChangesEveryFrame");
 	}
+	addComponent<MeshRenderer>();
+	updateMeshRenderer();
 
 	hr = m_sampler.init(device);
 	if (FAILED(hr)) {
-		ERROR("Actor", classNameType.c_str(), "Failed to create new SamplerState");
+		ERROR("Actor", "Actor -> " << m_name.c_str(), "Failed to create new SamplerState");
 	}
 
 	hr = m_rasterizer.init(device);
 	if (FAILED(hr)) {
-		ERROR("Actor", classNameType.c_str(), "Failed to create new Rasterizer");
+		ERROR("Actor", "Actor -> " << m_name.c_str(), "Failed to create new Rasterizer");
 	}
 
 	hr = m_blendstate.init(device);
 	if (FAILED(hr)) {
-		ERROR("Actor", classNameType.c_str(), "Failed to create new BlendState");
+		ERROR("Actor", "Actor -> " << m_name.c_str(), "Failed to create new BlendState");
 	}
 
 	hr = m_shaderShadow.CreateShader(device, PIXEL_SHADER, "HybridEngine.fx");
 
 	if (FAILED(hr)) {
 		ERROR("Main", "InitDevice",
-			("Failed to initialize Shadow Shader. HRESULT: " + std::to_string(hr)).c_str());
+			"Failed to initialize Shadow Shader. HRESULT: " << hr);
 	}
 
 	hr = m_shaderBuffer.init(device, sizeof(CBChangesEveryFrame));
 	if (FAILED(hr)) {
 		ERROR("Main", "InitDevice",
-			("Failed to initialize Shadow Buffer. HRESULT: " + std::to_string(hr)).c_str());
+			"Failed to initialize Shadow Buffer. HRESULT: " << hr);
 
 	}
 
 	hr = m_shadowBlendState.init(device);
 	if (FAILED(hr)) {
 		ERROR("Main", "InitDevice",
-			("Failed to initialize Shadow Blend State. HRESULT: " + std::to_string(hr)).c_str());
+			"Failed to initialize Shadow Blend State. HRESULT: " << hr);
 
 	}
 
@@ -57,28 +59,59 @@ Actor::Actor(Device& device) {
 
 	if (FAILED(hr)) {
 		ERROR("Main", "InitDevice",
-			("Failed to initialize Depth Stencil State. HRESULT: " + std::to_string(hr)).c_str());
+			"Failed to initialize Depth Stencil State. HRESULT: " << hr);
 
 	}
 
 	m_LightPos = XMFLOAT4(2.0f, 4.0f, -2.0f, 1.0f);
 }
 
-void
-Actor::update(float deltaTime, DeviceContext& deviceContext) {
-	// Update all components
-	for (auto& component : m_components) {
-		if (component) {
-			component->update(deltaTime);
+Actor::~Actor() {
+	// El nodo de la jerarquía no pertenece al chunk: se libera antes que la entidad
+	if (Transform* transform = getComponent<Transform>()) {
+		if (transform->getSceneNode() != InvalidSceneNode) {
+			m_world->getSceneGraph().destroyNode(transform->getSceneNode());
 		}
 	}
+}
 
-	// Update the model buffer
-	m_model.mWorld = XMMatrixTranspose(getComponent<Transform>()->matrix);
-	m_model.vMeshColor = XMFLOAT4(1.0f, 1.0f, 1.0f, m_receiveShadow ? 1.0f : 0.0f);
+void
+Actor::update(float deltaTime, DeviceContext& deviceContext) {
+	updateCPU(deltaTime);
+	uploadGPU(deviceContext);
+}
 
-	// Update the constant buffer
-	m_modelBuffer.update(deviceContext, nullptr, 0, nullptr, &m_model, 0, 0);
+void
+Actor::updateCPU(float /*deltaTime*/) {
+	// Los componentes los actualizan los sistemas del mundo (ver BaseApp::update)
+	// Solo se preparan los buffers si la matriz cambió desde la última vez
+	const Transform* transform = getComponent<const Transform>();
+	uint32_t version = transform->getWorldVersion();
+	if (m_modelDirty || version != m_modelVersion) {
+		m_model.mWorld = XMMatrixTranspose(transform->getWorldMatrix());
+		m_model.vMeshColor = XMFLOAT4(1.0f, 1.0f, 1.0f, m_receiveShadow ? 1.0f : 0.0f);
+		m_modelVersion = version;
+		m_modelDirty = false;
+		m_modelPending = true;
+	}
+	if (m_shadowDirty || version != m_shadowVersion) {
+		computeShadowMatrix(*transform);
+		m_shadowVersion = version;
+		m_shadowDirty = false;
+		m_shadowPending = true;
+	}
+}
+
+void
+Actor::uploadGPU(DeviceContext& deviceContext) {
+	if (m_modelPending) {
+		m_modelBuffer.update(deviceContext, nullptr, 0, nullptr, &m_model, 0, 0);
+		m_modelPending = false;
+	}
+	if (m_shadowPending) {
+		m_shaderBuffer.update(deviceContext, nullptr, 0, nullptr, &m_cbShadow, 0, 0);
+		m_shadowPending = false;
+	}
 }
 
 void
@@ -122,14 +155,27 @@ Actor::destroy() {
 	}
 	m_modelBuffer.destroy();
 
+	// Los handles del chunk ya no son válidos
+	m_draws.clear();
+	if (MeshRenderer* renderer = getComponent<MeshRenderer>()) {
+		*renderer = MeshRenderer();
+	}
+
 	m_rasterizer.destroy();
 	m_blendstate.destroy();
 	m_sampler.destroy();
 }
 
 void
-Actor::setMesh(Device& device, std::vector<MeshComponent> meshes) {
-	m_meshes = meshes;
+Actor::setMesh(Device& device, EU::TArrayView<const MeshComponent> meshes) {
+	setMesh(device, std::vector<MeshComponent>(meshes.begin(), meshes.end()));
+}
+
+void
+Actor::setMesh(Device& device, std::vector<MeshComponent>&& meshes) {
+	m_meshes = std::move(meshes);
+	m_vertexBuffers.reserve(m_vertexBuffers.size() + m_meshes.size());
+	m_indexBuffers.reserve(m_indexBuffers.size() + m_meshes.size());
 	HRESULT hr;
 	for (auto& mesh : m_meshes) {
 		// Crear vertex buffer
@@ -152,20 +198,58 @@ Actor::setMesh(Device& device, std::vector<MeshComponent> meshes) {
 			m_indexBuffers.push_back(indexBuffer);
 		}
 	}
+	updateMeshRenderer();
+}
+
+void
+Actor::updateMeshRenderer() {
+	size_t count = (std::min)(m_meshes.size(), (std::min)(m_vertexBuffers.size(), m_indexBuffers.size()));
+	m_draws.resize(count);
+	for (size_t i = 0; i < count; ++i) {
+		m_draws[i].vertexBuffer = m_vertexBuffers[i].getBuffer();
+		m_draws[i].stride = m_vertexBuffers[i].getStride();
+		m_draws[i].indexBuffer = m_indexBuffers[i].getBuffer();
+		m_draws[i].indexCount = static_cast<unsigned int>(m_meshes[i].m_numIndex);
+	}
+
+	if (MeshRenderer* renderer = getComponent<MeshRenderer>()) {
+		renderer->modelBuffer = m_modelBuffer.getBuffer();
+		renderer->draws = m_draws.data();
+		renderer->drawCount = static_cast<unsigned int>(count);
+	}
 }
 
 void
 Actor::renderShadow(DeviceContext& deviceContext) {
+	// m_cbShadow ya se subió en uploadGPU()
+	m_shaderBuffer.render(deviceContext, 2, 1, true);
+
+	// 3) Bind de shader y estados
+	float blendFactor[4] = { 0.f, 0.f, 0.f, 0.f };
+	m_shaderShadow.render(deviceContext, PIXEL_SHADER);
+	m_shadowBlendState.render(deviceContext, blendFactor, 0xffffffff);
+	m_shadowDepthStencilState.render(deviceContext, 0);
+
+	deviceContext.IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	// 4) Dibujar cada malla del actor
+	for (size_t i = 0; i < m_meshes.size(); ++i) {
+		m_vertexBuffers[i].render(deviceContext, 0, 1);
+		m_indexBuffers[i].render(deviceContext, 0, 1, false, DXGI_FORMAT_R32_UINT);
+		deviceContext.DrawIndexed(m_meshes[i].m_numIndex, 0, 0);
+	}
+}
+
+void
+Actor::computeShadowMatrix(const Transform& transform) {
 // --- 1) Descompón world en traslación + yaw + escala ---
-	auto t = getComponent<Transform>();
-	auto pos = t->getPosition();   // Vector3
-	auto yaw = t->getRotation().y; // sólo yaw
-	auto scl = t->getScale();      // Vector3
+	auto pos = transform.getPosition();   // Vector3
+	auto yaw = transform.getRotation().y; // sólo yaw
+	auto scl = transform.getScale();      // Vector3
 
 	XMMATRIX Mscale = XMMatrixScaling(scl.x, scl.y, scl.z);
 	XMMATRIX Myaw = XMMatrixRotationY(yaw);
 	XMMATRIX Mtrans = XMMatrixTranslation(pos.x, pos.y, pos.z);
-	XMMATRIX worldYaw = Mscale * Myaw * Mtrans;
+	XMMATRIX worldYaw = Mscale * Myaw * Mtrans * transform.getParentWorldMatrix();
 
 	// --- 2) Construye la matriz de proyección de sombra ---
 	//   para proyectar v' = v - (v.y / Ly) * L
@@ -183,23 +267,7 @@ Actor::renderShadow(DeviceContext& deviceContext) {
 
 	// --- 3) Aplica worldYaw * S para obtener la sombra en el suelo ---
 	XMMATRIX worldShadow = worldYaw * S;
-	// 2) Preparar y actualizar constant buffer
+	// 2) Preparar constant buffer
 	m_cbShadow.mWorld = XMMatrixTranspose(worldShadow);
 	m_cbShadow.vMeshColor = XMFLOAT4(0, 0, 0, 0.5f);
-	m_shaderBuffer.update(deviceContext, nullptr, 0, nullptr, &m_cbShadow, 0, 0);
-	m_shaderBuffer.render(deviceContext, 2, 1, true);
-
-	// 3) Bind de shader y estados
-	float blendFactor[4] = { 0.f, 0.f, 0.f, 0.f };
-	m_shaderShadow.render(deviceContext, PIXEL_SHADER);
-	m_shadowBlendState.render(deviceContext, blendFactor, 0xffffffff);
-	m_shadowDepthStencilState.render(deviceContext, 0);
-
-	deviceContext.IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-	// 4) Dibujar cada malla del actor
-	for (size_t i = 0; i < m_meshes.size(); ++i) {
-		m_vertexBuffers[i].render(deviceContext, 0, 1);
-		m_indexBuffers[i].render(deviceContext, 0, 1, false, DXGI_FORMAT_R32_UINT);
-		deviceContext.DrawIndexed(m_meshes[i].m_numIndex, 0, 0);
-	}
 }
\ No newline at end of file
@@ -0,0 +1,98 @@
+﻿#include "ECS/CommandBuffer.h"
+
+void
+EntityCommandBuffer::playback(World& world) {
+    // Las entidades nuevas se crean en lote sin realojar la tabla de registros
+    world.reserveEntities(m_pendingCount);
+    m_created.resize(m_pendingCount);
+
+    uint32_t created = 0;
+    for (Command& command : m_commands) {
+        switch (command.op) {
+        case Op::Create:
+            m_created[created++] = world.createEntity();
+            break;
+        case Op::Destroy:
+            world.destroyEntity(resolve(command.entity));
+            break;
+        case Op::Add: {
+            const ComponentInfo& info = ComponentRegistry::getInfo(command.type);
+            EntityID entity = resolve(command.entity);
+            if (world.isAlive(entity)) {
+                info.moveConstruct(world.emplaceComponent(entity, command.type), command.payload);
+            }
+            info.destroy(command.payload);
+            command.payload = nullptr;
+            break;
+        }
+        case Op::Remove: {
+            EntityID entity = resolve(command.entity);
+            if (world.isAlive(entity)) {
+                world.eraseComponent(entity, command.type);
+            }
+            break;
+        }
+        case Op::Custom:
+            command.invoke(command.payload, world);
+            command.destroy(command.payload);
+            command.payload = nullptr;
+            break;
+        }
+    }
+
+    m_created.clear();
+    clear();
+}
+
+void
+EntityCommandBuffer::clear() {
+    // Destruye lo que quedó sin aplicar (clear() sin playback())
+    for (Command& command : m_commands) {
+        if (!command.payload) {
+            continue;
+        }
+        if (command.op == Op::Add) {
+            ComponentRegistry::getInfo(command.type).destroy(command.payload);
+        } else if (command.op == Op::Custom) {
+            command.destroy(command.payload);
+        }
+    }
+    m_commands.clear();
+    m_storage.reset();
+    m_pendingCount = 0;
+}
+
+EntityCommandBuffer&
+EntityCommandQueue::getBuffer() {
+    struct ThreadSlot {
+        uint64_t queue = 0;
+        EntityCommandBuffer* buffer = nullptr;
+    };
+    static thread_local ThreadSlot s_slot;
+    if (s_slot.queue == m_id) {
+        return *s_slot.buffer;
+    }
+
+    // La caché por hilo solo recuerda la última cola usada: si el hilo ya tenía buffer aquí se reutiliza
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::thread::id thread = std::this_thread::get_id();
+    size_t index = 0;
+    while (index < m_threads.size() && m_threads[index] != thread) {
+        ++index;
+    }
+    if (index == m_threads.size()) {
+        m_threads.push_back(thread);
+        m_buffers.push_back(EU::MakeUnique<EntityCommandBuffer>());
+    }
+    s_slot.queue = m_id;
+    s_slot.buffer = m_buffers[index].get();
+    return *s_slot.buffer;
+}
+
+void
+EntityCommandQueue::playback(World& world) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& buffer : m_buffers) {
+        buffer->playback(world);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+﻿#include "ECS/CoreSystems.h"
+#include "ECS/Actor.h"
+
+TransformSystem::TransformSystem() :
+    System("TransformSystem") {
+    writes<Transform>();
+}
+
+void
+TransformSystem::update(World& world, EU::TThreadPool& /*pool*/, float deltaTime) {
+    // Los Transform viven contiguos en los chunks del mundo: se actualizan en una pasada lineal
+    world.each<Transform>([deltaTime](Transform& transform) { transform.update(deltaTime); });
+}
+
+SceneGraphSystem::SceneGraphSystem() :
+    System("SceneGraphSystem") {
+    writes<Transform>();
+}
+
+void
+SceneGraphSystem::update(World& world, EU::TThreadPool& pool, float /*deltaTime*/) {
+    // Matrices de mundo: una pasada lineal por la jerarquía, padres antes que hijos;
+    // cada raíz es un rango independiente y se reparten entre los trabajadores
+    SceneGraph& sceneGraph = world.getSceneGraph();
+    sceneGraph.prepareUpdate();
+    pool.parallelFor(sceneGraph.getRootCount(), 64, [&sceneGraph](size_t begin, size_t end) {
+        sceneGraph.updateRoots(begin, end);
+    });
+}
+
+ActorSystem::ActorSystem(std::vector<EU::TRefPtr<Actor>>& actors) :
+    System("ActorSystem"), m_actors(actors) {
+    reads<Transform>();
+}
+
+void
+ActorSystem::update(World& /*world*/, EU::TThreadPool& pool, float deltaTime) {
+    pool.parallelFor(m_actors.size(), 16, [this, deltaTime](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            if (!m_actors[i].isNull()) {
+                m_actors[i]->updateCPU(deltaTime);
+            }
+        }
+    });
+}
\ No newline at end of file
@@ -0,0 +1,302 @@
+﻿#include "ECS/SceneGraph.h"
+#include <algorithm>
+
+SceneNodeID
+SceneGraph::createNode(SceneNodeID parent) {
+    SceneNodeID node;
+    if (!m_freeNodes.empty()) {
+        node = m_freeNodes.back();
+        m_freeNodes.pop_back();
+    } else {
+        node = static_cast<SceneNodeID>(m_nodes.size());
+        m_nodes.push_back(NodeLinks());
+    }
+
+    // El nodo nuevo va al final; rebuildOrder() lo colocará tras su padre
+    uint32_t slot = static_cast<uint32_t>(m_slotNode.size());
+    pushIdentity();
+    m_local.push_back(XMMatrixIdentity());
+    m_world.push_back(XMMatrixIdentity());
+    m_parentSlot.push_back(-1);
+    m_subtreeSize.push_back(1);
+    m_version.push_back(0);
+    m_slotNode.push_back(node);
+    m_dirty.push_back(1);
+    m_subtreeDirty.push_back(1);
+    m_changed.push_back(0);
+
+    NodeLinks& links = m_nodes[node];
+    links = NodeLinks();
+    links.slot = slot;
+    links.alive = true;
+    if (parent != InvalidSceneNode) {
+        linkChild(parent, node);
+    }
+    m_orderDirty = true;
+    return node;
+}
+
+void
+SceneGraph::destroyNode(SceneNodeID node) {
+    if (node >= m_nodes.size() || !m_nodes[node].alive) {
+        return;
+    }
+    NodeLinks& links = m_nodes[node];
+    SceneNodeID parent = links.parent;
+    if (parent != InvalidSceneNode) {
+        unlinkChild(parent, node);
+    }
+
+    // Los hijos suben un nivel y conservan su matriz local
+    SceneNodeID child = links.firstChild;
+    while (child != InvalidSceneNode) {
+        SceneNodeID next = m_nodes[child].nextSibling;
+        m_nodes[child].parent = InvalidSceneNode;
+        m_nodes[child].nextSibling = InvalidSceneNode;
+        if (parent != InvalidSceneNode) {
+            linkChild(parent, child);
+        }
+        child = next;
+    }
+
+    m_slotNode[links.slot] = InvalidSceneNode;
+    links = NodeLinks();
+    m_freeNodes.push_back(node);
+    m_orderDirty = true;
+}
+
+void
+SceneGraph::setParent(SceneNodeID node, SceneNodeID parent) {
+    NodeLinks& links = m_nodes[node];
+    if (links.parent == parent) {
+        return;
+    }
+    for (SceneNodeID ancestor = parent; ancestor != InvalidSceneNode; ancestor = m_nodes[ancestor].parent) {
+        if (ancestor == node) {
+            ERROR("SceneGraph", "setParent", "Reparenting node " << node << " under " << parent << " would create a cycle");
+            return;
+        }
+    }
+
+    if (links.parent != InvalidSceneNode) {
+        unlinkChild(links.parent, node);
+    }
+    if (parent != InvalidSceneNode) {
+        linkChild(parent, node);
+    }
+    m_orderDirty = true;
+}
+
+void
+SceneGraph::setLocalTransform(SceneNodeID node, const XMFLOAT3& position, const XMFLOAT4& rotation, const XMFLOAT3& scale) {
+    uint32_t slot = m_nodes[node].slot;
+    m_positionX[slot] = position.x;
+    m_positionY[slot] = position.y;
+    m_positionZ[slot] = position.z;
+    m_rotationX[slot] = rotation.x;
+    m_rotationY[slot] = rotation.y;
+    m_rotationZ[slot] = rotation.z;
+    m_rotationW[slot] = rotation.w;
+    m_scaleX[slot] = scale.x;
+    m_scaleY[slot] = scale.y;
+    m_scaleZ[slot] = scale.z;
+    m_dirty[slot] = 1;
+    markDirty(slot);
+}
+
+void
+SceneGraph::update() {
+    prepareUpdate();
+    updateRoots(0, m_roots.size());
+}
+
+void
+SceneGraph::prepareUpdate() {
+    if (m_orderDirty) {
+        rebuildOrder();
+    }
+}
+
+void
+SceneGraph::updateRoots(size_t first, size_t last) {
+    assert(!m_orderDirty && "SceneGraph::prepareUpdate must run before updateRoots");
+    for (size_t root = first; root < last; ++root) {
+        uint32_t begin = m_roots[root];
+        uint32_t end = begin + m_subtreeSize[begin];
+        if (!m_subtreeDirty[begin]) {
+            continue;
+        }
+        composeLocals(begin, end);
+
+        uint32_t i = begin;
+        while (i < end) {
+            int32_t parent = m_parentSlot[i];
+            bool parentChanged = parent >= 0 && m_changed[parent];
+            if (m_dirty[i] || parentChanged) {
+                m_world[i] = parent >= 0 ? XMMatrixMultiply(m_local[i], m_world[parent]) : m_local[i];
+                ++m_version[i];
+                m_changed[i] = 1;
+                m_dirty[i] = 0;
+                m_subtreeDirty[i] = 0;
+                ++i;
+            } else if (m_subtreeDirty[i]) {
+                // El nodo no cambia pero algún descendiente sí
+                m_changed[i] = 0;
+                m_subtreeDirty[i] = 0;
+                ++i;
+            } else {
+                // Subárbol sin cambios: se salta entero
+                i += m_subtreeSize[i];
+            }
+        }
+    }
+}
+
+void
+SceneGraph::pushIdentity() {
+    m_positionX.push_back(0.0f);
+    m_positionY.push_back(0.0f);
+    m_positionZ.push_back(0.0f);
+    m_rotationX.push_back(0.0f);
+    m_rotationY.push_back(0.0f);
+    m_rotationZ.push_back(0.0f);
+    m_rotationW.push_back(1.0f);
+    m_scaleX.push_back(1.0f);
+    m_scaleY.push_back(1.0f);
+    m_scaleZ.push_back(1.0f);
+}
+
+void
+SceneGraph::composeLocals(uint32_t begin, uint32_t end) {
+    TransformStreams streams;
+    streams.positionX = m_positionX.data();
+    streams.positionY = m_positionY.data();
+    streams.positionZ = m_positionZ.data();
+    streams.rotationX = m_rotationX.data();
+    streams.rotationY = m_rotationY.data();
+    streams.rotationZ = m_rotationZ.data();
+    streams.rotationW = m_rotationW.data();
+    streams.scaleX = m_scaleX.data();
+    streams.scaleY = m_scaleY.data();
+    streams.scaleZ = m_scaleZ.data();
+
+    // Un bloque con algún nodo marcado se compone entero: recomponer los limpios da el mismo
+    // resultado y sale más barato que separar carriles
+    for (uint32_t block = begin; block < end; block += TransformBatchSize) {
+        uint32_t count = (std::min)(static_cast<uint32_t>(TransformBatchSize), end - block);
+        for (uint32_t i = 0; i < count; ++i) {
+            if (m_dirty[block + i]) {
+                ComposeTransforms(streams, block, count, m_local.data());
+                break;
+            }
+        }
+    }
+}
+
+void
+SceneGraph::linkChild(SceneNodeID parent, SceneNodeID child) {
+    m_nodes[child].parent = parent;
+    m_nodes[child].nextSibling = m_nodes[parent].firstChild;
+    m_nodes[parent].firstChild = child;
+}
+
+void
+SceneGraph::unlinkChild(SceneNodeID parent, SceneNodeID child) {
+    SceneNodeID* link = &m_nodes[parent].firstChild;
+    while (*link != child) {
+        link = &m_nodes[*link].nextSibling;
+    }
+    *link = m_nodes[child].nextSibling;
+    m_nodes[child].parent = InvalidSceneNode;
+    m_nodes[child].nextSibling = InvalidSceneNode;
+}
+
+void
+SceneGraph::markDirty(uint32_t slot) {
+    // Con el orden pendiente rebuildOrder() marcará todos los nodos
+    if (m_orderDirty) {
+        return;
+    }
+    for (int32_t current = static_cast<int32_t>(slot); current >= 0 && !m_subtreeDirty[current];
+         current = m_parentSlot[current]) {
+        m_subtreeDirty[current] = 1;
+    }
+}
+
+void
+SceneGraph::rebuildOrder() {
+    // Preorden: raíces en el orden actual de sus slots y cada hijo justo tras su subárbol padre
+    m_order.clear();
+    m_stack.clear();
+    for (uint32_t slot = static_cast<uint32_t>(m_slotNode.size()); slot-- > 0;) {
+        SceneNodeID node = m_slotNode[slot];
+        if (node != InvalidSceneNode && m_nodes[node].parent == InvalidSceneNode) {
+            m_stack.push_back(node);
+        }
+    }
+    while (!m_stack.empty()) {
+        SceneNodeID node = m_stack.back();
+        m_stack.pop_back();
+        m_order.push_back(m_nodes[node].slot);
+        for (SceneNodeID child = m_nodes[node].firstChild; child != InvalidSceneNode;
+             child = m_nodes[child].nextSibling) {
+            m_stack.push_back(child);
+        }
+    }
+
+    // Permutar los datos por nodo; los huecos de nodos destruidos desaparecen
+    size_t count = m_order.size();
+    EU::TAlignedVector<float, EU::SimdAlignment, EU::EMemoryTag::ECS>* streams[] = {
+        &m_positionX, &m_positionY, &m_positionZ,
+        &m_rotationX, &m_rotationY, &m_rotationZ, &m_rotationW,
+        &m_scaleX, &m_scaleY, &m_scaleZ,
+    };
+    for (auto* stream : streams) {
+        m_scratch.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            m_scratch[i] = (*stream)[m_order[i]];
+        }
+        stream->swap(m_scratch);
+    }
+    EU::TAlignedVector<XMMATRIX, EU::SimdAlignment, EU::EMemoryTag::ECS> local(count);
+    EU::TAlignedVector<XMMATRIX, EU::SimdAlignment, EU::EMemoryTag::ECS> world(count);
+    std::vector<uint32_t> version(count);
+    std::vector<SceneNodeID> slotNode(count);
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t oldSlot = m_order[i];
+        local[i] = m_local[oldSlot];
+        world[i] = m_world[oldSlot];
+        version[i] = m_version[oldSlot];
+        slotNode[i] = m_slotNode[oldSlot];
+    }
+    m_local.swap(local);
+    m_world.swap(world);
+    m_version.swap(version);
+    m_slotNode.swap(slotNode);
+    for (uint32_t slot = 0; slot < count; ++slot) {
+        m_nodes[m_slotNode[slot]].slot = slot;
+    }
+
+    m_parentSlot.resize(count);
+    m_subtreeSize.assign(count, 1);
+    m_roots.clear();
+    for (uint32_t slot = 0; slot < count; ++slot) {
+        SceneNodeID parent = m_nodes[m_slotNode[slot]].parent;
+        m_parentSlot[slot] = parent != InvalidSceneNode ? static_cast<int32_t>(m_nodes[parent].slot) : -1;
+        if (parent == InvalidSceneNode) {
+            m_roots.push_back(slot);
+        }
+    }
+    // Los hijos van después del padre: acumulando hacia atrás cada tamaño está completo al sumarlo
+    for (uint32_t slot = static_cast<uint32_t>(count); slot-- > 0;) {
+        if (m_parentSlot[slot] >= 0) {
+            m_subtreeSize[m_parentSlot[slot]] += m_subtreeSize[slot];
+        }
+    }
+
+    // Los padres pueden haber cambiado: se recalcula todo una vez
+    m_dirty.assign(count, 1);
+    m_subtreeDirty.assign(count, 1);
+    m_changed.assign(count, 0);
+    m_orderDirty = false;
+}
\ No newline at end of file
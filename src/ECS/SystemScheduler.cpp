@@ -0,0 +1,57 @@
+﻿#include "ECS/SystemScheduler.h"
+
+void
+SystemScheduler::run(World& world, float deltaTime) {
+    if (m_graphDirty) {
+        buildGraph();
+    }
+
+    for (size_t level = 0; level + 1 < m_levelStart.size(); ++level) {
+        size_t begin = m_levelStart[level];
+        size_t count = m_levelStart[level + 1] - begin;
+        if (count == 1) {
+            runSystem(*m_ordered[begin], world, deltaTime);
+            continue;
+        }
+        m_pool.parallelFor(count, 1, [this, &world, deltaTime, begin](size_t first, size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                runSystem(*m_ordered[begin + i], world, deltaTime);
+            }
+        });
+    }
+}
+
+void
+SystemScheduler::buildGraph() {
+    // Nivel de cada sistema: uno más que el mayor nivel de los anteriores con los que choca
+    std::vector<size_t> levels(m_systems.size(), 0);
+    size_t levelCount = 0;
+    for (size_t i = 0; i < m_systems.size(); ++i) {
+        for (size_t j = 0; j < i; ++j) {
+            if (m_systems[j]->conflictsWith(*m_systems[i])) {
+                levels[i] = (std::max)(levels[i], levels[j] + 1);
+            }
+        }
+        levelCount = (std::max)(levelCount, levels[i] + 1);
+    }
+
+    m_ordered.clear();
+    m_levelStart.clear();
+    for (size_t level = 0; level < levelCount; ++level) {
+        m_levelStart.push_back(m_ordered.size());
+        for (size_t i = 0; i < m_systems.size(); ++i) {
+            if (levels[i] == level) {
+                m_ordered.push_back(m_systems[i].get());
+            }
+        }
+    }
+    m_levelStart.push_back(m_ordered.size());
+    m_graphDirty = false;
+}
+
+void
+SystemScheduler::runSystem(System& system, World& world, float deltaTime) {
+    World::setCurrentAccess(&system.getAccess());
+    system.update(world, m_pool, deltaTime);
+    World::setCurrentAccess(nullptr);
+}
\ No newline at end of file
@@ -6,19 +6,36 @@ Transform::init() {
     scale.one();
 
     matrix = XMMatrixIdentity();
+    m_dirty = true;
 }
 
 void
 Transform::update(float deltaTime) {
-    // Aplicar escala
-    XMMATRIX scaleMatrix = XMMatrixScaling(scale.x, scale.y, scale.z);
-    // Aplicar rotacion
-    XMMATRIX rotationMatrix = XMMatrixRotationRollPitchYaw(rotation.x, rotation.y, rotation.z);
-    // Aplicar traslacion
-    XMMATRIX translationMatrix = XMMatrixTranslation(position.x, position.y, position.z);
-
-    // Componer la matriz final en el orden: scale -> rotation -> translation
-    matrix = scaleMatrix * rotationMatrix * translationMatrix;
+    if (!m_dirty) {
+        return;
+    }
+
+    if (m_graph) {
+        // El SceneGraph compone las matrices locales por bloques SIMD
+        m_graph->setLocalTransform(m_node,
+                                   XMFLOAT3(position.x, position.y, position.z),
+                                   m_orientation,
+                                   XMFLOAT3(scale.x, scale.y, scale.z));
+    } else {
+        // Componer la matriz final en el orden: scale -> rotation -> translation
+        matrix = XMMatrixScaling(scale.x, scale.y, scale.z) *
+                 XMMatrixRotationQuaternion(XMLoadFloat4(&m_orientation)) *
+                 XMMatrixTranslation(position.x, position.y, position.z);
+    }
+    m_dirty = false;
+    ++m_version;
+}
+
+void
+Transform::setRotation(const EU::Vector3& newRot) {
+    rotation = newRot;
+    updateOrientation();
+    m_dirty = true;
 }
 
 void 
@@ -28,4 +45,34 @@ Transform::setTransform(const EU::Vector3& newPos,
     position = newPos;
     rotation = newRot;
     scale = newSca;
+    updateOrientation();
+    m_dirty = true;
+}
+
+void
+Transform::setParent(const Transform* parent) {
+    if (!m_graph) {
+        ERROR("Transform", "setParent", "Transform is not attached to a SceneGraph");
+        return;
+    }
+    m_graph->setParent(m_node, parent ? parent->m_node : InvalidSceneNode);
+}
+
+XMMATRIX
+Transform::getParentWorldMatrix() const {
+    if (!m_graph || m_graph->getParent(m_node) == InvalidSceneNode) {
+        return XMMatrixIdentity();
+    }
+    return m_graph->getWorldMatrix(m_graph->getParent(m_node));
+}
+
+void
+Transform::translate(const EU::Vector3& translation) {
+    position = position + translation;
+    m_dirty = true;
+}
+
+void
+Transform::updateOrientation() {
+    XMStoreFloat4(&m_orientation, XMQuaternionRotationRollPitchYaw(rotation.x, rotation.y, rotation.z));
 }
\ No newline at end of file
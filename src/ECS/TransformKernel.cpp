@@ -0,0 +1,103 @@
+﻿#include "ECS/TransformKernel.h"
+#include "ECS/TransformKernelSIMD.h"
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace {
+    /**
+     * @brief true si la CPU y el sistema operativo admiten AVX (registros YMM guardados en los cambios de contexto).
+     */
+    bool
+    cpuHasAVX() {
+#if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 1);
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        bool avx = (info[2] & (1 << 28)) != 0;
+        return osxsave && avx && (_xgetbv(0) & 0x6) == 0x6;
+#else
+        return __builtin_cpu_supports("avx") != 0;
+#endif
+    }
+
+    /**
+     * @brief Compone 4 transformaciones a partir del elemento index.
+     */
+    inline void
+    compose4(const TransformStreams& s, size_t index, XMMATRIX* matrices) {
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 two = _mm_set1_ps(2.0f);
+        __m128 qx = _mm_loadu_ps(s.rotationX + index);
+        __m128 qy = _mm_loadu_ps(s.rotationY + index);
+        __m128 qz = _mm_loadu_ps(s.rotationZ + index);
+        __m128 qw = _mm_loadu_ps(s.rotationW + index);
+        __m128 sx = _mm_loadu_ps(s.scaleX + index);
+        __m128 sy = _mm_loadu_ps(s.scaleY + index);
+        __m128 sz = _mm_loadu_ps(s.scaleZ + index);
+
+        __m128 xx = _mm_mul_ps(qx, qx), yy = _mm_mul_ps(qy, qy), zz = _mm_mul_ps(qz, qz);
+        __m128 xy = _mm_mul_ps(qx, qy), xz = _mm_mul_ps(qx, qz), yz = _mm_mul_ps(qy, qz);
+        __m128 wx = _mm_mul_ps(qw, qx), wy = _mm_mul_ps(qw, qy), wz = _mm_mul_ps(qw, qz);
+
+        // Filas de la matriz de rotación (convención de vector fila de DirectXMath) por la escala
+        __m128 m00 = _mm_mul_ps(sx, _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))));
+        __m128 m01 = _mm_mul_ps(sx, _mm_mul_ps(two, _mm_add_ps(xy, wz)));
+        __m128 m02 = _mm_mul_ps(sx, _mm_mul_ps(two, _mm_sub_ps(xz, wy)));
+        __m128 m10 = _mm_mul_ps(sy, _mm_mul_ps(two, _mm_sub_ps(xy, wz)));
+        __m128 m11 = _mm_mul_ps(sy, _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))));
+        __m128 m12 = _mm_mul_ps(sy, _mm_mul_ps(two, _mm_add_ps(yz, wx)));
+        __m128 m20 = _mm_mul_ps(sz, _mm_mul_ps(two, _mm_add_ps(xz, wy)));
+        __m128 m21 = _mm_mul_ps(sz, _mm_mul_ps(two, _mm_sub_ps(yz, wx)));
+        __m128 m22 = _mm_mul_ps(sz, _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))));
+
+        TransformKernelDetail::storeRows(matrices + index, m00, m01, m02, m10, m11, m12, m20, m21, m22,
+                  _mm_loadu_ps(s.positionX + index),
+                  _mm_loadu_ps(s.positionY + index),
+                  _mm_loadu_ps(s.positionZ + index));
+    }
+
+
+    /**
+     * @brief Compone una sola transformación (resto que no llena un bloque SIMD).
+     */
+    inline void
+    compose1(const TransformStreams& s, size_t i, XMMATRIX* matrices) {
+        float qx = s.rotationX[i], qy = s.rotationY[i], qz = s.rotationZ[i], qw = s.rotationW[i];
+        float sx = s.scaleX[i], sy = s.scaleY[i], sz = s.scaleZ[i];
+        float* out = reinterpret_cast<float*>(&matrices[i]);
+        out[0] = sx * (1.0f - 2.0f * (qy * qy + qz * qz));
+        out[1] = sx * 2.0f * (qx * qy + qw * qz);
+        out[2] = sx * 2.0f * (qx * qz - qw * qy);
+        out[3] = 0.0f;
+        out[4] = sy * 2.0f * (qx * qy - qw * qz);
+        out[5] = sy * (1.0f - 2.0f * (qx * qx + qz * qz));
+        out[6] = sy * 2.0f * (qy * qz + qw * qx);
+        out[7] = 0.0f;
+        out[8] = sz * 2.0f * (qx * qz + qw * qy);
+        out[9] = sz * 2.0f * (qy * qz - qw * qx);
+        out[10] = sz * (1.0f - 2.0f * (qx * qx + qy * qy));
+        out[11] = 0.0f;
+        out[12] = s.positionX[i];
+        out[13] = s.positionY[i];
+        out[14] = s.positionZ[i];
+        out[15] = 1.0f;
+    }
+}
+
+void
+ComposeTransforms(const TransformStreams& streams, size_t first, size_t count, XMMATRIX* matrices) {
+    // El camino AVX está en su propia unidad compilada con /arch:AVX; se elige una vez en tiempo de ejecución
+    static const bool hasAVX = cpuHasAVX();
+    size_t i = first;
+    size_t end = first + count;
+    if (hasAVX) {
+        i += ComposeTransformsAVX(streams, first, count, matrices);
+    }
+    for (; i + 4 <= end; i += 4) {
+        compose4(streams, i, matrices);
+    }
+    for (; i < end; ++i) {
+        compose1(streams, i, matrices);
+    }
+}
\ No newline at end of file
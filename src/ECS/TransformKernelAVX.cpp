@@ -0,0 +1,61 @@
+﻿#include "ECS/TransformKernelSIMD.h"
+
+// Esta unidad se compila con /arch:AVX (ver HybridEngine_2010.vcxproj); no debe llamarse sin comprobar la CPU
+
+namespace {
+    /**
+     * @brief Compone 8 transformaciones a partir del elemento index.
+     */
+    inline void
+    compose8(const TransformStreams& s, size_t index, XMMATRIX* matrices) {
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 two = _mm256_set1_ps(2.0f);
+        __m256 qx = _mm256_loadu_ps(s.rotationX + index);
+        __m256 qy = _mm256_loadu_ps(s.rotationY + index);
+        __m256 qz = _mm256_loadu_ps(s.rotationZ + index);
+        __m256 qw = _mm256_loadu_ps(s.rotationW + index);
+        __m256 sx = _mm256_loadu_ps(s.scaleX + index);
+        __m256 sy = _mm256_loadu_ps(s.scaleY + index);
+        __m256 sz = _mm256_loadu_ps(s.scaleZ + index);
+
+        __m256 xx = _mm256_mul_ps(qx, qx), yy = _mm256_mul_ps(qy, qy), zz = _mm256_mul_ps(qz, qz);
+        __m256 xy = _mm256_mul_ps(qx, qy), xz = _mm256_mul_ps(qx, qz), yz = _mm256_mul_ps(qy, qz);
+        __m256 wx = _mm256_mul_ps(qw, qx), wy = _mm256_mul_ps(qw, qy), wz = _mm256_mul_ps(qw, qz);
+
+        __m256 m[9] = {
+            _mm256_mul_ps(sx, _mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(yy, zz)))),
+            _mm256_mul_ps(sx, _mm256_mul_ps(two, _mm256_add_ps(xy, wz))),
+            _mm256_mul_ps(sx, _mm256_mul_ps(two, _mm256_sub_ps(xz, wy))),
+            _mm256_mul_ps(sy, _mm256_mul_ps(two, _mm256_sub_ps(xy, wz))),
+            _mm256_mul_ps(sy, _mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(xx, zz)))),
+            _mm256_mul_ps(sy, _mm256_mul_ps(two, _mm256_add_ps(yz, wx))),
+            _mm256_mul_ps(sz, _mm256_mul_ps(two, _mm256_add_ps(xz, wy))),
+            _mm256_mul_ps(sz, _mm256_mul_ps(two, _mm256_sub_ps(yz, wx))),
+            _mm256_mul_ps(sz, _mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(xx, yy)))),
+        };
+        __m256 tx = _mm256_loadu_ps(s.positionX + index);
+        __m256 ty = _mm256_loadu_ps(s.positionY + index);
+        __m256 tz = _mm256_loadu_ps(s.positionZ + index);
+
+        // Las dos mitades de 4 carriles se trasponen como en el camino SSE
+        TransformKernelDetail::storeRows(matrices + index,
+                  _mm256_castps256_ps128(m[0]), _mm256_castps256_ps128(m[1]), _mm256_castps256_ps128(m[2]),
+                  _mm256_castps256_ps128(m[3]), _mm256_castps256_ps128(m[4]), _mm256_castps256_ps128(m[5]),
+                  _mm256_castps256_ps128(m[6]), _mm256_castps256_ps128(m[7]), _mm256_castps256_ps128(m[8]),
+                  _mm256_castps256_ps128(tx), _mm256_castps256_ps128(ty), _mm256_castps256_ps128(tz));
+        TransformKernelDetail::storeRows(matrices + index + 4,
+                  _mm256_extractf128_ps(m[0], 1), _mm256_extractf128_ps(m[1], 1), _mm256_extractf128_ps(m[2], 1),
+                  _mm256_extractf128_ps(m[3], 1), _mm256_extractf128_ps(m[4], 1), _mm256_extractf128_ps(m[5], 1),
+                  _mm256_extractf128_ps(m[6], 1), _mm256_extractf128_ps(m[7], 1), _mm256_extractf128_ps(m[8], 1),
+                  _mm256_extractf128_ps(tx, 1), _mm256_extractf128_ps(ty, 1), _mm256_extractf128_ps(tz, 1));
+    }
+}
+
+size_t
+ComposeTransformsAVX(const TransformStreams& streams, size_t first, size_t count, XMMATRIX* matrices) {
+    size_t blocks = count / 8;
+    for (size_t block = 0; block < blocks; ++block) {
+        compose8(streams, first + block * 8, matrices);
+    }
+    return blocks * 8;
+}
@@ -0,0 +1,256 @@
+﻿#include "ECS/World.h"
+
+World::World() :
+    m_chunkPool(ChunkSize, ColumnAlignment, EU::EMemoryTag::ECS) {
+    m_emptyArchetype = getOrCreateArchetype(0);
+}
+
+World::~World() {
+    for (auto& archetype : m_archetypes) {
+        for (Chunk& chunk : archetype->chunks) {
+            for (size_t column = 0; column < archetype->types.size(); ++column) {
+                const ComponentInfo& info = ComponentRegistry::getInfo(archetype->types[column]);
+                for (uint32_t row = 0; row < chunk.count; ++row) {
+                    info.destroy(archetype->component(chunk, static_cast<int>(column), row));
+                }
+            }
+            m_chunkPool.deallocate(chunk.data);
+        }
+    }
+}
+
+EntityID
+World::createEntity() {
+    EntityID entity;
+    if (!m_freeRecords.empty()) {
+        entity.index = m_freeRecords.back();
+        m_freeRecords.pop_back();
+    } else {
+        entity.index = static_cast<uint32_t>(m_records.size());
+        m_records.push_back(EntityRecord());
+    }
+    EntityRecord& record = m_records[entity.index];
+    entity.generation = record.generation;
+    record.archetype = m_emptyArchetype;
+    allocateRow(*m_emptyArchetype, entity, record.chunk, record.row);
+    ++m_entityCount;
+    return entity;
+}
+
+void
+World::destroyEntity(EntityID entity) {
+    if (!isAlive(entity)) {
+        return;
+    }
+    EntityRecord& record = m_records[entity.index];
+    Archetype& archetype = *record.archetype;
+    Chunk& chunk = archetype.chunks[record.chunk];
+    for (size_t column = 0; column < archetype.types.size(); ++column) {
+        ComponentRegistry::getInfo(archetype.types[column]).destroy(
+            archetype.component(chunk, static_cast<int>(column), record.row));
+    }
+    removeRow(archetype, record.chunk, record.row);
+
+    record.archetype = nullptr;
+    ++record.generation;
+    m_freeRecords.push_back(entity.index);
+    --m_entityCount;
+}
+
+void*
+World::emplaceComponent(EntityID entity, ComponentTypeID type) {
+    assert(isAlive(entity));
+    EntityRecord& record = m_records[entity.index];
+    int column = record.archetype->findColumn(type);
+    if (column < 0) {
+        moveEntity(entity, getAddTarget(record.archetype, type), type);
+        column = record.archetype->findColumn(type);
+    } else {
+        ComponentRegistry::getInfo(type).destroy(
+            record.archetype->component(record.archetype->chunks[record.chunk], column, record.row));
+    }
+    return record.archetype->component(record.archetype->chunks[record.chunk], column, record.row);
+}
+
+void
+World::eraseComponent(EntityID entity, ComponentTypeID type) {
+    assert(isAlive(entity));
+    EntityRecord& record = m_records[entity.index];
+    if (record.archetype->mask & (ComponentMask(1) << type)) {
+        moveEntity(entity, getRemoveTarget(record.archetype, type), type);
+    }
+}
+
+size_t
+World::getChunkCount() const {
+    size_t total = 0;
+    for (const auto& archetype : m_archetypes) {
+        total += archetype->chunks.size();
+    }
+    return total;
+}
+
+Archetype*
+World::getOrCreateArchetype(ComponentMask mask) {
+    for (auto& archetype : m_archetypes) {
+        if (archetype->mask == mask) {
+            return archetype.get();
+        }
+    }
+
+    EU::TUniquePtr<Archetype> archetype = EU::MakeUnique<Archetype>();
+    archetype->mask = mask;
+    std::fill(std::begin(archetype->columnIndex), std::end(archetype->columnIndex), int8_t(-1));
+    std::fill(std::begin(archetype->addEdges), std::end(archetype->addEdges), nullptr);
+    std::fill(std::begin(archetype->removeEdges), std::end(archetype->removeEdges), nullptr);
+    for (ComponentTypeID type = 0; type < MaxComponentTypes; ++type) {
+        if (mask & (ComponentMask(1) << type)) {
+            archetype->columnIndex[type] = static_cast<int8_t>(archetype->types.size());
+            archetype->types.push_back(type);
+        }
+    }
+    const std::vector<ComponentTypeID>& types = archetype->types;
+    archetype->columnOffsets.resize(types.size());
+    archetype->columnSizes.resize(types.size());
+
+    size_t bytesPerEntity = sizeof(EntityID);
+    for (size_t i = 0; i < types.size(); ++i) {
+        const ComponentInfo& info = ComponentRegistry::getInfo(types[i]);
+        assert(info.alignment <= ColumnAlignment && "Component alignment exceeds chunk column alignment");
+        archetype->columnSizes[i] = info.size;
+        bytesPerEntity += info.size;
+    }
+
+    // Máximo de entidades que caben contando el relleno que alinea cada columna
+    uint32_t capacity = static_cast<uint32_t>(ChunkSize / bytesPerEntity);
+    while (capacity > 0) {
+        size_t offset = sizeof(EntityID) * capacity;
+        for (size_t i = 0; i < types.size(); ++i) {
+            offset = (offset + ColumnAlignment - 1) & ~(ColumnAlignment - 1);
+            archetype->columnOffsets[i] = offset;
+            offset += archetype->columnSizes[i] * capacity;
+        }
+        if (offset <= ChunkSize) {
+            break;
+        }
+        --capacity;
+    }
+    assert(capacity > 0 && "Component set does not fit in a chunk");
+    archetype->capacity = capacity;
+
+    // Las consultas ya creadas incorporan el arquetipo nuevo si cumple su firma
+    for (auto& query : m_queries) {
+        if (query->matches(*archetype)) {
+            query->archetypes.push_back(archetype.get());
+        }
+    }
+
+    m_archetypes.push_back(std::move(archetype));
+    return m_archetypes.back().get();
+}
+
+QueryCache*
+World::getQueryCache(ComponentMask required, ComponentMask excluded) {
+    for (auto& query : m_queries) {
+        if (query->required == required && query->excluded == excluded) {
+            return query.get();
+        }
+    }
+
+    EU::TUniquePtr<QueryCache> query = EU::MakeUnique<QueryCache>();
+    query->required = required;
+    query->excluded = excluded;
+    for (auto& archetype : m_archetypes) {
+        if (query->matches(*archetype)) {
+            query->archetypes.push_back(archetype.get());
+        }
+    }
+    m_queries.push_back(std::move(query));
+    return m_queries.back().get();
+}
+
+Archetype*
+World::getAddTarget(Archetype* source, ComponentTypeID type) {
+    if (!source->addEdges[type]) {
+        source->addEdges[type] = getOrCreateArchetype(source->mask | (ComponentMask(1) << type));
+    }
+    return source->addEdges[type];
+}
+
+Archetype*
+World::getRemoveTarget(Archetype* source, ComponentTypeID type) {
+    if (!source->removeEdges[type]) {
+        source->removeEdges[type] = getOrCreateArchetype(source->mask & ~(ComponentMask(1) << type));
+    }
+    return source->removeEdges[type];
+}
+
+void
+World::allocateRow(Archetype& archetype, EntityID entity, uint32_t& chunkIndex, uint32_t& row) {
+    if (archetype.chunks.empty() || archetype.chunks.back().count == archetype.capacity) {
+        Chunk chunk;
+        chunk.data = static_cast<unsigned char*>(m_chunkPool.allocate());
+        archetype.chunks.push_back(chunk);
+    }
+    chunkIndex = static_cast<uint32_t>(archetype.chunks.size() - 1);
+    Chunk& chunk = archetype.chunks.back();
+    row = chunk.count++;
+    archetype.entities(chunk)[row] = entity;
+    ++archetype.entityCount;
+}
+
+void
+World::removeRow(Archetype& archetype, uint32_t chunkIndex, uint32_t row) {
+    Chunk& last = archetype.chunks.back();
+    uint32_t lastRow = last.count - 1;
+    Chunk& chunk = archetype.chunks[chunkIndex];
+
+    // La última entidad del arquetipo ocupa el hueco para que los chunks sigan compactos
+    if (&chunk != &last || row != lastRow) {
+        EntityID moved = archetype.entities(last)[lastRow];
+        for (size_t column = 0; column < archetype.types.size(); ++column) {
+            const ComponentInfo& info = ComponentRegistry::getInfo(archetype.types[column]);
+            void* source = archetype.component(last, static_cast<int>(column), lastRow);
+            info.moveConstruct(archetype.component(chunk, static_cast<int>(column), row), source);
+            info.destroy(source);
+        }
+        archetype.entities(chunk)[row] = moved;
+        m_records[moved.index].chunk = chunkIndex;
+        m_records[moved.index].row = row;
+    }
+
+    --last.count;
+    --archetype.entityCount;
+    if (last.count == 0) {
+        m_chunkPool.deallocate(last.data);
+        archetype.chunks.pop_back();
+    }
+}
+
+void
+World::moveEntity(EntityID entity, Archetype* target, ComponentTypeID changedType) {
+    EntityRecord& record = m_records[entity.index];
+    Archetype& source = *record.archetype;
+    uint32_t sourceChunk = record.chunk;
+    uint32_t sourceRow = record.row;
+
+    uint32_t targetChunk;
+    uint32_t targetRow;
+    allocateRow(*target, entity, targetChunk, targetRow);
+
+    Chunk& from = source.chunks[sourceChunk];
+    Chunk& to = target->chunks[targetChunk];
+    for (size_t column = 0; column < source.types.size(); ++column) {
+        const ComponentInfo& info = ComponentRegistry::getInfo(source.types[column]);
+        void* component = source.component(from, static_cast<int>(column), sourceRow);
+        if (source.types[column] != changedType) {
+            info.moveConstruct(target->component(to, target->findColumn(source.types[column]), targetRow), component);
+        }
+        info.destroy(component);
+    }
+
+    removeRow(source, sourceChunk, sourceRow);
+    record.archetype = target;
+    record.chunk = targetChunk;
+    record.row = targetRow;
+}
\ No newline at end of file
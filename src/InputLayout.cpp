@@ -4,9 +4,9 @@
 
 HRESULT
 InputLayout::init(Device& device,
-                  std::vector<D3D11_INPUT_ELEMENT_DESC>& Layout,
+                  EU::TArrayView<const D3D11_INPUT_ELEMENT_DESC> Layout,
                   ID3DBlob* VertexShaderData) {
-    if (Layout.empty()) {
+    if (Layout.IsEmpty()) {
         ERROR("InputLayout", "init", "Layout vector is empty.");
         return E_INVALIDARG;
     }
@@ -15,15 +15,15 @@ InputLayout::init(Device& device,
         return E_POINTER;
     }
 
-    HRESULT hr = device.CreateInputLayout(Layout.data(),
-                                          static_cast<unsigned int>(Layout.size()),
+    HRESULT hr = device.CreateInputLayout(Layout.GetData(),
+                                          static_cast<unsigned int>(Layout.Num()),
                                           VertexShaderData->GetBufferPointer(),
                                           VertexShaderData->GetBufferSize(),
                                           &m_inputLayout);
 
     if (FAILED(hr)) {
         ERROR("InputLayout", "init",
-              ("Failed to create InputLayout. HRESULT: " + std::to_string(hr)).c_str());
+              "Failed to create InputLayout. HRESULT: " << hr);
         return hr;
     }
 
@@ -0,0 +1,19 @@
+﻿#include "MeshComponent.h"
+
+void
+MeshComponent::loadMeshData(EU::TArrayView<const SimpleVertex> vertices,
+                            EU::TArrayView<const unsigned int> indices) {
+    m_vertex.assign(vertices.begin(), vertices.end());
+    m_index.assign(indices.begin(), indices.end());
+    m_numVertex = static_cast<int>(m_vertex.size());
+    m_numIndex = static_cast<int>(m_index.size());
+}
+
+void
+MeshComponent::loadMeshData(std::vector<SimpleVertex>&& vertices,
+                            std::vector<unsigned int>&& indices) {
+    m_vertex = std::move(vertices);
+    m_index = std::move(indices);
+    m_numVertex = static_cast<int>(m_vertex.size());
+    m_numIndex = static_cast<int>(m_index.size());
+}
\ No newline at end of file
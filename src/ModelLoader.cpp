@@ -93,7 +93,7 @@ ModelLoader::LoadFBXModel(const std::string& filePath) {
             return false;
         } else {
             MESSAGE("ModelLoader", "ModelLoader", "FBX Scene imported successfully.");
-            modelName = lImporter->GetFileName();
+            modelName = lImporter->GetFileName().Buffer();
         }
 
         // 05. Destroy the importer
@@ -139,9 +139,29 @@ ModelLoader::ProcessFBXMesh(FbxNode* node) {
     if (!mesh)
         return;
 
+    // Todo lo reservado en m_scratch dentro de esta función se libera de golpe al salir
+    EU::TStackScope scratchScope(m_scratch);
+
+    // Posiciones de los puntos de control convertidas a float una sola vez, no en cada vértice de polígono
+    const int controlPointCount = mesh->GetControlPointsCount();
+    const FbxVector4* controlPoints = mesh->GetControlPoints();
+    XMFLOAT3* positions = m_scratch.allocateArray<XMFLOAT3>(controlPointCount);
+    for (int i = 0; i < controlPointCount; ++i) {
+        positions[i] = XMFLOAT3((float)controlPoints[i][0], (float)controlPoints[i][1], (float)controlPoints[i][2]);
+    }
+
+    // Contar los triángulos antes de empezar: los vectores finales se reservan con su tamaño exacto
+    const int polygonCount = mesh->GetPolygonCount();
+    int triangleCount = 0;
+    for (int i = 0; i < polygonCount; ++i) {
+        triangleCount += (std::max)(0, mesh->GetPolygonSize(i) - 2);
+    }
+
     // Vectores para guardar los datos finales de la malla
     std::vector<SimpleVertex> vertices;
     std::vector<unsigned int> indices;
+    vertices.reserve(mesh->GetPolygonVertexCount());
+    indices.reserve(static_cast<size_t>(triangleCount) * 3);
 
     // Obtener el elemento de coordenadas UV. Es la única variable que necesitamos verificar.
     FbxGeometryElementUV* uvElement = mesh->GetElementUV(0);
@@ -150,7 +170,7 @@ ModelLoader::ProcessFBXMesh(FbxNode* node) {
     int polyVertexCounter = 0;
 
     // Iterar sobre todos los polígonos de la malla
-    for (int i = 0; i < mesh->GetPolygonCount(); i++) {
+    for (int i = 0; i < polygonCount; i++) {
         const int polySize = mesh->GetPolygonSize(i);
         const int baseIndex = vertices.size();
 
@@ -160,8 +180,7 @@ ModelLoader::ProcessFBXMesh(FbxNode* node) {
 
             // 1. Obtener la POSICIÓN del vértice a través del Control Point
             const int controlPointIndex = mesh->GetPolygonVertex(i, j);
-            const FbxVector4 pos = mesh->GetControlPointAt(controlPointIndex);
-            currentVertex.Pos = XMFLOAT3((float)pos[0], (float)pos[1], (float)pos[2]);
+            currentVertex.Pos = positions[controlPointIndex];
 
             // 2. Obtener la COORDENADA UV
             // Verificamos si el elemento UV existe antes de intentar usarlo.
@@ -222,12 +241,9 @@ ModelLoader::ProcessFBXMesh(FbxNode* node) {
     // Crear el componente de malla con los datos procesados
     MeshComponent meshData;
     meshData.m_name = node->GetName();
-    meshData.m_vertex = std::move(vertices);
-    meshData.m_index = std::move(indices);
-    meshData.m_numVertex = meshData.m_vertex.size();
-    meshData.m_numIndex = meshData.m_index.size();
+    meshData.loadMeshData(std::move(vertices), std::move(indices));
 
-    meshes.push_back(meshData);
+    meshes.push_back(std::move(meshData));
 }
 
 void
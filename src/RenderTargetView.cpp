@@ -31,7 +31,7 @@ RenderTargetView::init(Device& device, Texture& backBuffer, DXGI_FORMAT Format)
                                                          &m_renderTargetView);
     if (FAILED(hr)) {
         ERROR("RenderTargetView", "init",
-              ("Failed to create render target view. HRESULT: " + std::to_string(hr)).c_str());
+              "Failed to create render target view. HRESULT: " << hr);
         return hr;
     }
 
@@ -69,7 +69,7 @@ RenderTargetView::init(Device& device,
 
     if (FAILED(hr)) {
         ERROR("RenderTargetView", "init",
-              ("Failed to create render target view. HRESULT: " + std::to_string(hr)).c_str());
+              "Failed to create render target view. HRESULT: " << hr);
         return hr;
     }
 
@@ -5,7 +5,7 @@
 HRESULT
 ShaderProgram::init(Device& device,
                     const std::string& fileName,
-                    std::vector<D3D11_INPUT_ELEMENT_DESC> Layout) {
+                    EU::TArrayView<const D3D11_INPUT_ELEMENT_DESC> Layout) {
     if (!device.m_device) {
         ERROR("ShaderProgram", "init", "Device is null.");
         return E_POINTER;
@@ -14,7 +14,7 @@ ShaderProgram::init(Device& device,
         ERROR("ShaderProgram", "init", "File name is empty.");
         return E_INVALIDARG;
     }
-    if (Layout.empty()) {
+    if (Layout.IsEmpty()) {
         ERROR("ShaderProgram", "init", "Input layout is empty.");
         return E_INVALIDARG;
     }
@@ -46,7 +46,7 @@ ShaderProgram::init(Device& device,
 
 HRESULT
 ShaderProgram::CreateInputLayout(Device& device,
-                                 std::vector<D3D11_INPUT_ELEMENT_DESC> Layout) {
+                                 EU::TArrayView<const D3D11_INPUT_ELEMENT_DESC> Layout) {
     if (!m_vertexShaderData) {
         ERROR("ShaderProgram", "CreateInputLayout", "Vertex shader data is null.");
         return E_POINTER;
@@ -55,7 +55,7 @@ ShaderProgram::CreateInputLayout(Device& device,
         ERROR("ShaderProgram", "CreateInputLayout", "Device is null.");
         return E_POINTER;
     }
-    if (Layout.empty()) {
+    if (Layout.IsEmpty()) {
         ERROR("ShaderProgram", "CreateInputLayout", "Input layout is empty.");
         return E_INVALIDARG;
     }
@@ -60,7 +60,7 @@ SwapChain::init(Device& device,
 
     if (FAILED(hr)) {
         ERROR("SwapChain", "init",
-              ("Failed to create D3D11 device. HRESULT: " + std::to_string(hr)).c_str());
+              "Failed to create D3D11 device. HRESULT: " << hr);
         return hr;
     }
 
@@ -71,7 +71,7 @@ SwapChain::init(Device& device,
                                                         &m_qualityLevels);
     if (FAILED(hr) || m_qualityLevels == 0) {
         ERROR("SwapChain", "init",
-              ("MSAA not supported or invalid quality level. HRESULT: " + std::to_string(hr)).c_str());
+              "MSAA not supported or invalid quality level. HRESULT: " << hr);
         return hr;
     }
 
@@ -95,14 +95,14 @@ SwapChain::init(Device& device,
     hr = device.m_device->QueryInterface(__uuidof(IDXGIDevice), (void**)&m_dxgiDevice);
     if (FAILED(hr)) {
         ERROR("SwapChain", "init",
-              ("Failed to query IDXGIDevice. HRESULT: " + std::to_string(hr)).c_str());
+              "Failed to query IDXGIDevice. HRESULT: " << hr);
         return hr;
     }
 
     hr = m_dxgiDevice->GetAdapter(&m_dxgiAdapter);
     if (FAILED(hr)) {
         ERROR("SwapChain", "init",
-              ("Failed to get IDXGIAdapter. HRESULT: " + std::to_string(hr)).c_str());
+              "Failed to get IDXGIAdapter. HRESULT: " << hr);
         return hr;
     }
 
@@ -110,7 +110,7 @@ SwapChain::init(Device& device,
                                   reinterpret_cast<void**>(&m_dxgiFactory));
     if (FAILED(hr)) {
         ERROR("SwapChain", "init",
-              ("Failed to get IDXGIFactory. HRESULT: " + std::to_string(hr)).c_str());
+              "Failed to get IDXGIFactory. HRESULT: " << hr);
         return hr;
     }
 
@@ -119,7 +119,7 @@ SwapChain::init(Device& device,
 
     if (FAILED(hr)) {
         ERROR("SwapChain", "init",
-              ("Failed to create swap chain. HRESULT: " + std::to_string(hr)).c_str());
+              "Failed to create swap chain. HRESULT: " << hr);
         return hr;
     }
 
@@ -128,7 +128,7 @@ SwapChain::init(Device& device,
                                 reinterpret_cast<void**>(&backBuffer));
     if (FAILED(hr)) {
         ERROR("SwapChain", "init",
-              ("Failed to get back buffer. HRESULT: " + std::to_string(hr)).c_str());
+              "Failed to get back buffer. HRESULT: " << hr);
         return hr;
     }
 
@@ -158,7 +158,7 @@ SwapChain::present() {
         HRESULT hr = m_swapChain->Present(0, 0);
         if (FAILED(hr)) {
             ERROR("SwapChain", "present",
-                  ("Failed to present swap chain. HRESULT: " + std::to_string(hr)).c_str());
+                  "Failed to present swap chain. HRESULT: " << hr);
         }
     } else {
         ERROR("SwapChain", "present", "Swap chain is not initialized.");
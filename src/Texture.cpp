@@ -4,6 +4,51 @@
 #include "Device.h"
 #include "DeviceContext.h"
 
+// Bits por píxel de los formatos habituales; los BC se cuentan por píxel dentro de bloques 4x4
+static unsigned int
+formatBitsPerPixel(DXGI_FORMAT format) {
+    switch (format) {
+    case DXGI_FORMAT_R32G32B32A32_TYPELESS:
+    case DXGI_FORMAT_R32G32B32A32_FLOAT:
+        return 128;
+    case DXGI_FORMAT_R16G16B16A16_TYPELESS:
+    case DXGI_FORMAT_R16G16B16A16_FLOAT:
+    case DXGI_FORMAT_R32G32_FLOAT:
+        return 64;
+    case DXGI_FORMAT_R8_UNORM:
+    case DXGI_FORMAT_A8_UNORM:
+    case DXGI_FORMAT_BC2_UNORM:
+    case DXGI_FORMAT_BC3_UNORM:
+    case DXGI_FORMAT_BC5_UNORM:
+    case DXGI_FORMAT_BC6H_UF16:
+    case DXGI_FORMAT_BC7_UNORM:
+        return 8;
+    case DXGI_FORMAT_BC1_UNORM:
+    case DXGI_FORMAT_BC4_UNORM:
+        return 4;
+    case DXGI_FORMAT_R16_TYPELESS:
+    case DXGI_FORMAT_R16_FLOAT:
+    case DXGI_FORMAT_D16_UNORM:
+        return 16;
+    default:
+        return 32;
+    }
+}
+
+// Estimación del tamaño en GPU de una textura 2D con toda su cadena de mips
+static size_t
+estimateTextureBytes(const D3D11_TEXTURE2D_DESC& desc) {
+    size_t bytes = 0;
+    unsigned int bpp = formatBitsPerPixel(desc.Format);
+    unsigned int mips = desc.MipLevels ? desc.MipLevels : 1;
+    for (unsigned int mip = 0; mip < mips; ++mip) {
+        size_t w = (std::max)(1u, desc.Width >> mip);
+        size_t h = (std::max)(1u, desc.Height >> mip);
+        bytes += w * h * bpp / 8;
+    }
+    return bytes * desc.ArraySize * (std::max)(1u, desc.SampleDesc.Count);
+}
+
 HRESULT
 Texture::init(Device device, const std::wstring& textureName, ExtensionType extensionType) {
     if (!device.m_device) {
@@ -41,6 +86,20 @@ Texture::init(Device device, const std::wstring& textureName, ExtensionType exte
         return hr;
     }
 
+    ID3D11Resource* resource = nullptr;
+    m_textureFromImg->GetResource(&resource);
+    if (resource) {
+        ID3D11Texture2D* texture2D = nullptr;
+        if (SUCCEEDED(resource->QueryInterface(__uuidof(ID3D11Texture2D), (void**)&texture2D))) {
+            D3D11_TEXTURE2D_DESC desc;
+            texture2D->GetDesc(&desc);
+            m_trackedBytes = estimateTextureBytes(desc);
+            EU::TMemoryTracker::get().recordAlloc(EU::EMemoryTag::TEXTURE, m_trackedBytes);
+            texture2D->Release();
+        }
+        resource->Release();
+    }
+
     return hr;
 }
 
@@ -80,10 +139,12 @@ Texture::init(Device device,
 
     if (FAILED(hr)) {
         ERROR("Texture", "init",
-              ("Failed to create texture with specified params. HRESULT: " + std::to_string(hr)).c_str());
+              "Failed to create texture with specified params. HRESULT: " << hr);
         return hr;
     }
 
+    m_trackedBytes = estimateTextureBytes(desc);
+    EU::TMemoryTracker::get().recordAlloc(EU::EMemoryTag::TEXTURE, m_trackedBytes);
     return S_OK;
 }
 
@@ -111,7 +172,7 @@ Texture::init(Device& device, Texture& textureRef, DXGI_FORMAT format) {
 
     if (FAILED(hr)) {
         ERROR("Texture", "init",
-              ("Failed to create shader resource view for PNG textures. HRESULT: " + std::to_string(hr)).c_str());
+              "Failed to create shader resource view for PNG textures. HRESULT: " << hr);
         return hr;
     }
 
@@ -138,8 +199,48 @@ Texture::render(DeviceContext& deviceContext,
     }
 }
 
+Texture::Texture(const Texture& other) :
+    m_texture(other.m_texture),
+    m_textureFromImg(other.m_textureFromImg),
+    m_textureName(other.m_textureName),
+    m_trackedBytes(0) {
+}
+
+Texture&
+Texture::operator=(const Texture& other) {
+    m_texture = other.m_texture;
+    m_textureFromImg = other.m_textureFromImg;
+    m_textureName = other.m_textureName;
+    m_trackedBytes = 0;
+    return *this;
+}
+
+Texture::Texture(Texture&& other) noexcept :
+    m_texture(other.m_texture),
+    m_textureFromImg(other.m_textureFromImg),
+    m_textureName(std::move(other.m_textureName)),
+    m_trackedBytes(other.m_trackedBytes) {
+    other.m_trackedBytes = 0;
+}
+
+Texture&
+Texture::operator=(Texture&& other) noexcept {
+    if (this != &other) {
+        m_texture = other.m_texture;
+        m_textureFromImg = other.m_textureFromImg;
+        m_textureName = std::move(other.m_textureName);
+        m_trackedBytes = other.m_trackedBytes;
+        other.m_trackedBytes = 0;
+    }
+    return *this;
+}
+
 void
 Texture::destroy() {
+    if (m_trackedBytes) {
+        EU::TMemoryTracker::get().recordFree(EU::EMemoryTag::TEXTURE, m_trackedBytes);
+        m_trackedBytes = 0;
+    }
     if (m_texture != nullptr) {
         SAFE_RELEASE(m_texture);
     } else if (m_textureFromImg != nullptr) {
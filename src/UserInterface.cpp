@@ -39,6 +39,11 @@ UserInterface::update() {
     ImGui::NewFrame();
 }
 
+void
+UserInterface::setFrameArena(EU::TFrameArena<2>* frameArena) {
+    m_frameArena = frameArena;
+}
+
 void
 UserInterface::render() {
     ImGui::Render();
@@ -46,12 +51,12 @@ UserInterface::render() {
 }
 
 void
-UserInterface::vec3Control(const std::string& label, float* values, float resetValue, float columnWidth) {
-    ImGui::PushID(label.c_str());
+UserInterface::vec3Control(const char* label, float* values, float resetValue, float columnWidth) {
+    ImGui::PushID(label);
 
     ImGui::Columns(2);
     ImGui::SetColumnWidth(0, columnWidth);
-    ImGui::Text(label.c_str());
+    ImGui::Text("%s", label);
     ImGui::NextColumn();
 
     ImGui::PushMultiItemsWidths(3, ImGui::CalcItemWidth());
@@ -101,12 +106,12 @@ UserInterface::vec3Control(const std::string& label, float* values, float resetV
 }
 
 void
-UserInterface::floatControl(const std::string& label, float* value, float resetValue, float columnWidth) {
-    ImGui::PushID(label.c_str());
+UserInterface::floatControl(const char* label, float* value, float resetValue, float columnWidth) {
+    ImGui::PushID(label);
 
     ImGui::Columns(2);
     ImGui::SetColumnWidth(0, columnWidth);
-    ImGui::Text(label.c_str());
+    ImGui::Text("%s", label);
     ImGui::NextColumn();
 
     ImGui::PushItemWidth(-1.0f);
@@ -174,7 +179,7 @@ UserInterface::mainMenuBar() {
 }
 
 void
-UserInterface::objectControlPanel(EU::TSharedPointer<Actor> actor) {
+UserInterface::objectControlPanel(const EU::TRefPtr<Actor>& actor) {
     if (!showObjectControls || actor.isNull()) {
         return;
     }
@@ -183,7 +188,7 @@ UserInterface::objectControlPanel(EU::TSharedPointer<Actor> actor) {
     ImGui::SetNextWindowSize(ImVec2(330, 500), ImGuiCond_FirstUseEver);
 
     if (ImGui::Begin("Object Controls", &showObjectControls)) {
-        ImGui::Text("Selected Object: Actor %d", selectedActorIndex);
+        ImGui::Text("Selected Object: %s", actor->getName().c_str());
         ImGui::Separator();
 
         if (ImGui::CollapsingHeader("Transform", ImGuiTreeNodeFlags_DefaultOpen)) {
@@ -219,7 +224,7 @@ UserInterface::objectControlPanel(EU::TSharedPointer<Actor> actor) {
 }
 
 void
-UserInterface::transformControls(EU::TSharedPointer<Actor> actor) {
+UserInterface::transformControls(const EU::TRefPtr<Actor>& actor) {
     if (selectedActorIndex == 0) {
         ImGui::Text("Position: Locked (Floor)");
         ToolTip("El piso no se puede mover");
@@ -245,7 +250,7 @@ UserInterface::transformControls(EU::TSharedPointer<Actor> actor) {
 }
 
 void
-UserInterface::scaleControls(EU::TSharedPointer<Actor> actor) {
+UserInterface::scaleControls(const EU::TRefPtr<Actor>& actor) {
     if (selectedActorIndex == 0) {
         ImGui::Text("Scale: Locked (Floor)");
         ToolTip("La escala del piso está bloqueada");
@@ -280,7 +285,7 @@ UserInterface::scaleControls(EU::TSharedPointer<Actor> actor) {
 }
 
 void
-UserInterface::rotationControls(EU::TSharedPointer<Actor> actor) {
+UserInterface::rotationControls(const EU::TRefPtr<Actor>& actor) {
     if (selectedActorIndex == 0) {
         ImGui::Text("Rotation: Locked (Floor)");
         ToolTip("La rotación del piso está bloqueada");
@@ -369,8 +374,9 @@ UserInterface::showImportDialog() {
     if (ImGui::BeginPopupModal("Import Success", NULL, ImGuiWindowFlags_AlwaysAutoResize)) {
         ImGui::Text("Model imported successfully!");
 
-        // CAMBIO 3: Convertir wstring a string solo para mostrar en ImGui
-        std::string displayPath(selectedFilePath.begin(), selectedFilePath.end());
+        // CAMBIO 3: Convertir wstring a string solo para mostrar en ImGui (memoria del frame, sin heap)
+        EU::TArenaString displayPath(selectedFilePath.begin(), selectedFilePath.end(),
+                                     EU::TArenaAllocator<char>(m_frameArena->current()));
         ImGui::Text("File: %s", displayPath.c_str());
 
         ImGui::Separator();
@@ -409,19 +415,19 @@ UserInterface::closeApp() {
 }
 
 void
-UserInterface::ToolTip(std::string icon, std::string tip) {
+UserInterface::ToolTip(const char* icon, const char* tip) {
     if (ImGui::IsItemHovered()) {
         ImGui::BeginTooltip();
-        ImGui::Text("%s %s", icon.c_str(), tip.c_str());
+        ImGui::Text("%s %s", icon, tip);
         ImGui::EndTooltip();
     }
 }
 
 void
-UserInterface::ToolTip(std::string tip) {
+UserInterface::ToolTip(const char* tip) {
     if (ImGui::IsItemHovered()) {
         ImGui::BeginTooltip();
-        ImGui::Text("%s", tip.c_str());
+        ImGui::Text("%s", tip);
         ImGui::EndTooltip();
     }
 }
@@ -528,7 +534,7 @@ UserInterface::visualStudioStyle() {
 }
 
 void
-UserInterface::outliner(const std::vector<EU::TSharedPointer<Actor>>& actors) {
+UserInterface::outliner(const std::vector<EU::TRefPtr<Actor>>& actors) {
     ImGui::SetNextWindowPos(ImVec2(10, 25), ImGuiCond_FirstUseEver);
     ImGui::SetNextWindowSize(ImVec2(250, 400), ImGuiCond_FirstUseEver);
 
@@ -540,14 +546,15 @@ UserInterface::outliner(const std::vector<EU::TSharedPointer<Actor>>& actors) {
             if (actors[i].isNull())
                 continue;
 
-            std::string actorName = "Actor " + std::to_string(i);
-
             // Verificar si este actor está seleccionado
             bool isSelected = (selectedActorIndex == static_cast<int>(i));
 
-            if (ImGui::Selectable(actorName.c_str(), isSelected)) {
+            // El nombre internado se usa directamente; el ID evita colisiones entre nombres repetidos
+            ImGui::PushID(static_cast<int>(i));
+            if (ImGui::Selectable(actors[i]->getName().c_str(), isSelected)) {
                 selectedActorIndex = static_cast<int>(i);
             }
+            ImGui::PopID();
 
             if (ImGui::IsItemHovered()) {
                 ToolTip("Click para seleccionar este objeto");
@@ -595,3 +602,67 @@ UserInterface::cameraControlPanel(float* yawDeg, float* pitchDeg, float* distanc
     }
     ImGui::End();
 }
+
+void
+UserInterface::memoryPanel() {
+    ImGui::SetNextWindowPos(ImVec2(570, 440), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowSize(ImVec2(420, 220), ImGuiCond_FirstUseEver);
+    if (ImGui::Begin("Memory")) {
+        EU::TMemoryTracker& tracker = EU::TMemoryTracker::get();
+        const float toMB = 1.0f / (1024.0f * 1024.0f);
+        ImGui::Text("Total: %.2f MB", tracker.getTotalBytes() * toMB);
+        ImGui::SameLine();
+        if (ImGui::Button("Reset Peaks")) {
+            tracker.resetPeaks();
+        }
+        ToolTip("Iguala el pico de cada subsistema a su uso actual");
+
+        // Reservas de heap del último frame: en estado estable deberían ser cero
+        const EU::AllocationCounts& frameAllocations = EU::TAllocationCounter::get().getLastFrame();
+        if (frameAllocations.allocations) {
+            ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "Heap allocations last frame: %llu (%llu bytes)",
+                               static_cast<unsigned long long>(frameAllocations.allocations),
+                               static_cast<unsigned long long>(frameAllocations.bytes));
+        } else {
+            ImGui::Text("Heap allocations last frame: 0");
+        }
+
+        if (ImGui::BeginTable("MemoryTags", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+            ImGui::TableSetupColumn("Tag");
+            ImGui::TableSetupColumn("Current (MB)");
+            ImGui::TableSetupColumn("Peak (MB)");
+            ImGui::TableSetupColumn("Allocs");
+            ImGui::TableSetupColumn("Budget");
+            ImGui::TableHeadersRow();
+
+            for (int i = 0; i < static_cast<int>(EU::EMemoryTag::COUNT); ++i) {
+                EU::EMemoryTag tag = static_cast<EU::EMemoryTag>(i);
+                EU::MemoryTagStats stats = tracker.getStats(tag);
+                bool overBudget = tracker.isOverBudget(tag);
+
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                if (overBudget) {
+                    ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "%s", EU::GetMemoryTagName(tag));
+                } else {
+                    ImGui::Text("%s", EU::GetMemoryTagName(tag));
+                }
+                ImGui::TableNextColumn();
+                ImGui::Text("%.2f", stats.currentBytes * toMB);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.2f", stats.peakBytes * toMB);
+                ImGui::TableNextColumn();
+                ImGui::Text("%zu", stats.liveCount);
+                ImGui::TableNextColumn();
+                if (stats.budgetBytes) {
+                    float used = static_cast<float>(stats.currentBytes) / static_cast<float>(stats.budgetBytes);
+                    ImGui::ProgressBar((std::min)(used, 1.0f), ImVec2(-1.0f, 0.0f));
+                } else {
+                    ImGui::TextDisabled("-");
+                }
+            }
+            ImGui::EndTable();
+        }
+    }
+    ImGui::End();
+}
\ No newline at end of file